@@ -0,0 +1,360 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput and latency of rmw_publish/rmw_take and of
+// rmw_publish_serialized_message/rmw_take_serialized_message over a matrix of
+// payload sizes, reliability, history and publisher/subscription counts.
+//
+// Latency is measured one message at a time from rmw_publish to the return of
+// the take on each subscription; throughput by publishing as fast as possible
+// for --duration_ms while every subscription takes on its own thread.
+//
+// Options: --domain=0 --sizes=64,1024,65536,1048576,16777216 --publishers=1
+//          --subscriptions=1,4 --samples=1000 --duration_ms=1000 --depth=16
+//          --timeout_ms=10000 --output=<file>
+
+#include "benchmark_utils.hpp"
+
+#include <rmw/qos_profiles.h>
+#include <rmw/serialized_message.h>
+
+#include <rosidl_typesupport_cpp/message_type_support.hpp>
+
+#include <test_msgs/msg/unbounded_sequences.hpp>
+
+#include <atomic>
+
+namespace
+{
+
+using benchmark::Clock;
+using benchmark::JsonObject;
+
+const rosidl_message_type_support_t * type_support()
+{
+  return rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::UnboundedSequences>();
+}
+
+struct Case
+{
+  size_t size;
+  bool reliable;
+  bool keep_all;
+  size_t publishers;
+  size_t subscriptions;
+  bool serialized;
+};
+
+// One subscription's end of a message: rmw_take into a message or a serialized message.
+class Taker
+{
+public:
+  explicit Taker(bool serialized)
+  : serialized_(serialized)
+  , cdr_(rmw_get_zero_initialized_serialized_message())
+  {
+    benchmark::check(rmw_serialized_message_init(&cdr_, 0, &allocator_), "rmw_serialized_message_init");
+  }
+  ~Taker() { rmw_serialized_message_fini(&cdr_); }
+  Taker(const Taker &) = delete;
+  Taker & operator=(const Taker &) = delete;
+
+  // Take one message; return its payload size, 0 if none was taken.
+  size_t take(rmw_subscription_t * sub)
+  {
+    bool taken = false;
+    if (serialized_) {
+      benchmark::check(rmw_take_serialized_message(sub, &cdr_, &taken, nullptr), "rmw_take_serialized_message");
+      const size_t length = taken ? cdr_.buffer_length : 0;
+      // the take may replace the buffer, so release it every time
+      rmw_serialized_message_fini(&cdr_);
+      cdr_ = rmw_get_zero_initialized_serialized_message();
+      benchmark::check(rmw_serialized_message_init(&cdr_, 0, &allocator_), "rmw_serialized_message_init");
+      return length;
+    }
+    benchmark::check(rmw_take(sub, &msg_, &taken, nullptr), "rmw_take");
+    return taken ? msg_.uint8_values.size() : 0;
+  }
+
+private:
+  const bool serialized_;
+  rcutils_allocator_t allocator_ = rcutils_get_default_allocator();
+  rmw_serialized_message_t cdr_;
+  test_msgs::msg::UnboundedSequences msg_;
+};
+
+class Runner
+{
+public:
+  Runner(benchmark::Context & context, const benchmark::Args & args)
+  : context_(context)
+  , pub_node_(context, "benchmark_pubsub_publisher")
+  , sub_node_(context, "benchmark_pubsub_subscriber")
+  , samples_(args.get("samples", size_t(1000)))
+  , duration_(args.get("duration_ms", size_t(1000)))
+  , depth_(args.get("depth", size_t(16)))
+  , timeout_(args.get("timeout_ms", size_t(10000)))
+  , count_(0)
+  , cdr_(rmw_get_zero_initialized_serialized_message())
+  {}
+
+  JsonObject run(const Case & c)
+  {
+    rmw_qos_profile_t qos = rmw_qos_profile_default;
+    qos.reliability = c.reliable ? RMW_QOS_POLICY_RELIABILITY_RELIABLE : RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT;
+    qos.history = c.keep_all ? RMW_QOS_POLICY_HISTORY_KEEP_ALL : RMW_QOS_POLICY_HISTORY_KEEP_LAST;
+    qos.depth = depth_;
+    const std::string topic = "/benchmark_pubsub/case" + std::to_string(++count_);
+    const rmw_publisher_options_t pub_options = rmw_get_default_publisher_options();
+    const rmw_subscription_options_t sub_options = rmw_get_default_subscription_options();
+
+    std::vector<rmw_publisher_t *> pubs;
+    std::vector<rmw_subscription_t *> subs;
+    for (size_t i = 0; i < c.publishers; ++i) {
+      pubs.push_back(benchmark::check(
+        rmw_create_publisher(pub_node_.get(), type_support(), topic.c_str(), &qos, &pub_options),
+        "rmw_create_publisher"));
+    }
+    for (size_t i = 0; i < c.subscriptions; ++i) {
+      subs.push_back(benchmark::check(
+        rmw_create_subscription(sub_node_.get(), type_support(), topic.c_str(), &qos, &sub_options),
+        "rmw_create_subscription"));
+    }
+
+    JsonObject result;
+    result.add("size", c.size)
+    .add("reliability", c.reliable ? "reliable" : "best_effort")
+    .add("history", c.keep_all ? "keep_all" : "keep_last")
+    .add("depth", depth_)
+    .add("publishers", c.publishers)
+    .add("subscriptions", c.subscriptions)
+    .add("api", c.serialized ? "serialized" : "typed");
+
+    const bool matched = benchmark::wait_until([&]() {
+          for (auto p : pubs) {
+            size_t n = 0;
+            if (rmw_publisher_count_matched_subscriptions(p, &n) != RMW_RET_OK || n < subs.size()) {
+              return false;
+            }
+          }
+          return true;
+        }, timeout_);
+    result.add("matched", matched);
+    if (matched) {
+      prepare(c);
+      result.add("latency", latency(c, pubs[0], subs));
+      result.add("throughput", throughput(c, pubs, subs));
+      rmw_serialized_message_fini(&cdr_);
+    }
+
+    for (auto s : subs) {
+      rmw_destroy_subscription(sub_node_.get(), s);
+    }
+    for (auto p : pubs) {
+      rmw_destroy_publisher(pub_node_.get(), p);
+    }
+    return result;
+  }
+
+private:
+  void prepare(const Case & c)
+  {
+    msg_.uint8_values.assign(c.size, 0x5a);
+    cdr_ = rmw_get_zero_initialized_serialized_message();
+    rcutils_allocator_t allocator = rcutils_get_default_allocator();
+    benchmark::check(rmw_serialized_message_init(&cdr_, c.size + 1024, &allocator), "rmw_serialized_message_init");
+    benchmark::check(rmw_serialize(&msg_, type_support(), &cdr_), "rmw_serialize");
+  }
+
+  void publish(const Case & c, rmw_publisher_t * pub)
+  {
+    if (c.serialized) {
+      benchmark::check(rmw_publish_serialized_message(pub, &cdr_, nullptr), "rmw_publish_serialized_message");
+    } else {
+      benchmark::check(rmw_publish(pub, &msg_, nullptr), "rmw_publish");
+    }
+  }
+
+  void drain(const Case & c, const std::vector<rmw_subscription_t *> & subs)
+  {
+    Taker taker(c.serialized);
+    for (auto s : subs) {
+      while (taker.take(s)) {}
+    }
+  }
+
+  JsonObject latency(const Case & c, rmw_publisher_t * pub, const std::vector<rmw_subscription_t *> & subs)
+  {
+    // keep the run of large payloads bounded
+    const size_t samples = std::max<size_t>(10, std::min(samples_, (size_t(1) << 30) / (c.size + 1)));
+    benchmark::WaitSet wait_set(context_, subs.size());
+    Taker taker(c.serialized);
+    std::vector<double> latencies;
+    latencies.reserve(samples * subs.size());
+    size_t lost = 0;
+    drain(c, subs);
+    for (size_t i = 0; i < samples; ++i) {
+      std::vector<rmw_subscription_t *> pending = subs;
+      const auto start = Clock::now();
+      publish(c, pub);
+      while (!pending.empty()) {
+        const auto ready = wait_set.wait(pending, timeout_);
+        if (ready.empty()) {
+          lost += pending.size();
+          break;
+        }
+        std::vector<bool> is_ready(pending.size(), false);
+        for (size_t r : ready) {
+          is_ready[r] = true;
+        }
+        std::vector<rmw_subscription_t *> rest;
+        for (size_t j = 0; j < pending.size(); ++j) {
+          if (is_ready[j] && taker.take(pending[j])) {
+            latencies.push_back(benchmark::elapsed_us(start));
+          } else {
+            rest.push_back(pending[j]);
+          }
+        }
+        pending.swap(rest);
+      }
+    }
+    return benchmark::percentiles(latencies).add("lost", lost);
+  }
+
+  JsonObject throughput(const Case & c, const std::vector<rmw_publisher_t *> & pubs,
+    const std::vector<rmw_subscription_t *> & subs)
+  {
+    drain(c, subs);
+    std::atomic<bool> publishing(true);
+    std::atomic<bool> taking(true);
+    std::vector<std::atomic<size_t>> received(subs.size());
+    for (auto & r : received) {
+      r = 0;
+    }
+    std::vector<size_t> sent(pubs.size(), 0);
+    std::vector<std::thread> threads;
+    std::vector<std::string> errors(subs.size() + pubs.size());
+
+    for (size_t i = 0; i < subs.size(); ++i) {
+      threads.emplace_back([&, i]() {
+          try {
+            benchmark::WaitSet wait_set(context_, 1);
+            Taker taker(c.serialized);
+            const std::vector<rmw_subscription_t *> sub(1, subs[i]);
+            while (taking) {
+              if (!wait_set.wait(sub, std::chrono::milliseconds(100)).empty()) {
+                while (taker.take(subs[i])) {
+                  ++received[i];
+                }
+              }
+            }
+          } catch (const std::exception & e) {
+            errors[i] = e.what();
+          }
+        });
+    }
+    const auto start = Clock::now();
+    const auto deadline = start + duration_;
+    for (size_t i = 0; i < pubs.size(); ++i) {
+      threads.emplace_back([&, i]() {
+          try {
+            while (publishing && Clock::now() < deadline) {
+              publish(c, pubs[i]);
+              ++sent[i];
+            }
+          } catch (const std::exception & e) {
+            errors[subs.size() + i] = e.what();
+          }
+        });
+    }
+    for (size_t i = subs.size(); i < threads.size(); ++i) {
+      threads[i].join();
+    }
+    const double publish_s = benchmark::elapsed_ms(start) / 1000;
+    size_t total_sent = 0;
+    for (size_t n : sent) {
+      total_sent += n;
+    }
+    // let the subscriptions catch up before they stop
+    const size_t expected = total_sent * subs.size();
+    benchmark::wait_until([&]() {
+        size_t total = 0;
+        for (size_t i = 0; i < subs.size(); ++i) {
+          total += received[i];
+        }
+        return total >= expected;
+      }, std::chrono::milliseconds(2000), std::chrono::milliseconds(10));
+    const double receive_s = benchmark::elapsed_ms(start) / 1000;
+    taking = false;
+    for (size_t i = 0; i < subs.size(); ++i) {
+      threads[i].join();
+    }
+    for (const auto & e : errors) {
+      if (!e.empty()) {
+        throw std::runtime_error(e);
+      }
+    }
+
+    size_t total_received = 0;
+    for (const auto & n : received) {
+      total_received += n;
+    }
+    const double mb = static_cast<double>(total_received) * c.size / (1024 * 1024);
+    return JsonObject()
+           .add("published", total_sent)
+           .add("received", total_received)
+           .add("lost", expected > total_received ? expected - total_received : 0)
+           .add("publish_msgs_per_s", total_sent / publish_s)
+           .add("receive_msgs_per_s", total_received / receive_s)
+           .add("receive_mb_per_s", mb / receive_s);
+  }
+
+  benchmark::Context & context_;
+  benchmark::Node pub_node_;
+  benchmark::Node sub_node_;
+  const size_t samples_;
+  const std::chrono::milliseconds duration_;
+  const size_t depth_;
+  const std::chrono::milliseconds timeout_;
+  size_t count_;
+  test_msgs::msg::UnboundedSequences msg_;
+  rmw_serialized_message_t cdr_;
+};
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  return benchmark::run([argc, argv]() {
+    const benchmark::Args args(argc, argv);
+    benchmark::Context context(args.get("domain", size_t(0)));
+    Runner runner(context, args);
+
+    std::vector<JsonObject> cases;
+    for (size_t size : args.get_list("sizes", {64, 1024, 65536, 1048576, 16777216})) {
+      for (bool reliable : {true, false}) {
+        for (bool keep_all : {false, true}) {
+          for (size_t publishers : args.get_list("publishers", {1})) {
+            for (size_t subscriptions : args.get_list("subscriptions", {1, 4})) {
+              for (bool serialized : {false, true}) {
+                cases.push_back(runner.run(Case{size, reliable, keep_all, publishers, subscriptions, serialized}));
+              }
+            }
+          }
+        }
+      }
+    }
+    benchmark::emit(args, JsonObject().add("benchmark", "pubsub").add("cases", cases));
+  });
+}
@@ -0,0 +1,232 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Round trip latency and request rate of a service with --clients concurrent
+// clients, each sending requests of --sizes bytes back to back on its own
+// thread for --duration_ms, and the time until rmw_service_server_is_available
+// first returns true for a new client. The server echoes every request.
+//
+// Options: --domain=0 --sizes=64,65536,1048576 --clients=1,4,16,64
+//          --duration_ms=1000 --timeout_ms=10000 --output=<file>
+
+#include "benchmark_utils.hpp"
+
+#include <rmw/qos_profiles.h>
+
+#include <rosidl_typesupport_cpp/service_type_support.hpp>
+
+#include <test_msgs/srv/basic_types.hpp>
+
+#include <atomic>
+
+namespace
+{
+
+using benchmark::Clock;
+using benchmark::JsonObject;
+using test_msgs::srv::BasicTypes;
+
+const rosidl_service_type_support_t * type_support()
+{
+  return rosidl_typesupport_cpp::get_service_type_support_handle<BasicTypes>();
+}
+
+rmw_time_t to_rmw_time(std::chrono::milliseconds t)
+{
+  return rmw_time_t{static_cast<uint64_t>(t.count() / 1000), static_cast<uint64_t>(t.count() % 1000) * 1000000};
+}
+
+// Wait until the service or the client has data; return false on timeout.
+bool wait_for(benchmark::WaitSet & wait_set, rmw_service_t * service, rmw_client_t * client,
+  std::chrono::milliseconds timeout)
+{
+  void * handle = service ? service->data : client->data;
+  rmw_services_t services = {service ? 1u : 0u, service ? &handle : nullptr};
+  rmw_clients_t clients = {client ? 1u : 0u, client ? &handle : nullptr};
+  const rmw_time_t t = to_rmw_time(timeout);
+  const rmw_ret_t ret = rmw_wait(nullptr, nullptr, &services, &clients, nullptr, wait_set.get(), &t);
+  if (ret == RMW_RET_TIMEOUT) {
+    return false;
+  }
+  benchmark::check(ret, "rmw_wait");
+  return handle != nullptr;
+}
+
+// Echo server running on its own thread.
+class Server
+{
+public:
+  Server(benchmark::Context & context, benchmark::Node & node, const std::string & name)
+  : node_(node.get())
+  , service_(benchmark::check(rmw_create_service(node_, type_support(), name.c_str(), &rmw_qos_profile_services_default),
+      "rmw_create_service"))
+  , wait_set_(context, 1)
+  , running_(true)
+  , thread_([this]() {serve();})
+  {}
+
+  ~Server()
+  {
+    running_ = false;
+    thread_.join();
+    rmw_destroy_service(node_, service_);
+  }
+
+  const std::string & error() const { return error_; }
+
+private:
+  void serve()
+  {
+    try {
+      BasicTypes::Request request;
+      BasicTypes::Response response;
+      while (running_) {
+        if (!wait_for(wait_set_, service_, nullptr, std::chrono::milliseconds(100))) {
+          continue;
+        }
+        for (;;) {
+          rmw_service_info_t header;
+          bool taken = false;
+          benchmark::check(rmw_take_request(service_, &header, &request, &taken), "rmw_take_request");
+          if (!taken) {
+            break;
+          }
+          response.string_value.swap(request.string_value);
+          benchmark::check(rmw_send_response(service_, &header.request_id, &response), "rmw_send_response");
+        }
+      }
+    } catch (const std::exception & e) {
+      error_ = e.what();
+    }
+  }
+
+  rmw_node_t * node_;
+  rmw_service_t * service_;
+  benchmark::WaitSet wait_set_;
+  std::atomic<bool> running_;
+  std::string error_;
+  std::thread thread_;
+};
+
+JsonObject run(benchmark::Context & context, benchmark::Node & node, const std::string & name,
+  size_t size, size_t client_count, const benchmark::Args & args)
+{
+  const std::chrono::milliseconds duration(args.get("duration_ms", size_t(1000)));
+  const std::chrono::milliseconds timeout(args.get("timeout_ms", size_t(10000)));
+  JsonObject result;
+  result.add("size", size).add("clients", client_count);
+
+  std::vector<rmw_client_t *> clients;
+  const auto start = Clock::now();
+  for (size_t i = 0; i < client_count; ++i) {
+    clients.push_back(benchmark::check(
+      rmw_create_client(node.get(), type_support(), name.c_str(), &rmw_qos_profile_services_default),
+      "rmw_create_client"));
+  }
+  const bool available = benchmark::wait_until([&]() {
+        for (auto c : clients) {
+          bool is_available = false;
+          if (rmw_service_server_is_available(node.get(), c, &is_available) != RMW_RET_OK || !is_available) {
+            return false;
+          }
+        }
+        return true;
+      }, timeout);
+  result.add("server_available", available).add("server_available_ms", benchmark::elapsed_ms(start));
+
+  if (available) {
+    std::vector<std::vector<double>> latencies(client_count);
+    std::vector<size_t> timeouts(client_count, 0);
+    std::vector<std::string> errors(client_count);
+    std::vector<std::thread> threads;
+    const auto deadline = Clock::now() + duration;
+    for (size_t i = 0; i < client_count; ++i) {
+      threads.emplace_back([&, i]() {
+          try {
+            benchmark::WaitSet wait_set(context, 1);
+            BasicTypes::Request request;
+            request.string_value.assign(size, 'x');
+            BasicTypes::Response response;
+            while (Clock::now() < deadline) {
+              int64_t sequence = 0;
+              const auto sent = Clock::now();
+              benchmark::check(rmw_send_request(clients[i], &request, &sequence), "rmw_send_request");
+              bool done = false;
+              while (!done && wait_for(wait_set, nullptr, clients[i], timeout)) {
+                rmw_service_info_t header;
+                bool taken = false;
+                benchmark::check(rmw_take_response(clients[i], &header, &response, &taken), "rmw_take_response");
+                done = taken && header.request_id.sequence_number == sequence;
+              }
+              if (done) {
+                latencies[i].push_back(benchmark::elapsed_us(sent));
+              } else {
+                ++timeouts[i];
+              }
+            }
+          } catch (const std::exception & e) {
+            errors[i] = e.what();
+          }
+        });
+    }
+    for (auto & t : threads) {
+      t.join();
+    }
+    for (const auto & e : errors) {
+      if (!e.empty()) {
+        throw std::runtime_error(e);
+      }
+    }
+    std::vector<double> all;
+    size_t total_timeouts = 0;
+    for (size_t i = 0; i < client_count; ++i) {
+      all.insert(all.end(), latencies[i].begin(), latencies[i].end());
+      total_timeouts += timeouts[i];
+    }
+    const double seconds = std::chrono::duration<double>(duration).count();
+    result.add("requests_per_s", all.size() / seconds)
+    .add("timeouts", total_timeouts)
+    .add("round_trip", benchmark::percentiles(all));
+  }
+
+  for (auto c : clients) {
+    rmw_destroy_client(node.get(), c);
+  }
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  return benchmark::run([argc, argv]() {
+    const benchmark::Args args(argc, argv);
+    benchmark::Context context(args.get("domain", size_t(0)));
+    benchmark::Node server_node(context, "benchmark_service_server");
+    benchmark::Node client_node(context, "benchmark_service_client");
+    const std::string name = "/benchmark_service/echo";
+    Server server(context, server_node, name);
+
+    std::vector<JsonObject> results;
+    for (size_t size : args.get_list("sizes", {64, 65536, 1048576})) {
+      for (size_t clients : args.get_list("clients", {1, 4, 16, 64})) {
+        results.push_back(run(context, client_node, name, size, clients, args));
+        if (!server.error().empty()) {
+          throw std::runtime_error(server.error());
+        }
+      }
+    }
+    benchmark::emit(args, JsonObject().add("benchmark", "service").add("results", results));
+  });
+}
@@ -0,0 +1,176 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Wall time and memory of rmw_init, rmw_create_node and the creation of
+// N publishers, subscriptions, services and clients, and the time until
+// rmw_count_subscribers sees a subscription of another local node.
+//
+// Options: --domain=0 --count=100 --timeout_ms=30000 --output=<file>
+
+#include "benchmark_utils.hpp"
+
+#include <rmw_opendds_cpp/entity_batch.h>
+
+#include <rmw/qos_profiles.h>
+
+#include <rosidl_typesupport_cpp/message_type_support.hpp>
+#include <rosidl_typesupport_cpp/service_type_support.hpp>
+
+#include <test_msgs/msg/unbounded_sequences.hpp>
+#include <test_msgs/srv/basic_types.hpp>
+
+#include <memory>
+
+namespace
+{
+
+using benchmark::Clock;
+using benchmark::JsonObject;
+
+// Create count entities with create(i) and destroy them with destroy(entity).
+template<typename T>
+JsonObject measure(size_t count, const std::function<T *(size_t)> & create,
+  const std::function<void(T *)> & destroy)
+{
+  std::vector<T *> entities;
+  entities.reserve(count);
+  const size_t rss = benchmark::rss_kb();
+  const auto start = Clock::now();
+  for (size_t i = 0; i < count; ++i) {
+    entities.push_back(create(i));
+  }
+  const double create_ms = benchmark::elapsed_ms(start);
+  const int64_t rss_delta = benchmark::rss_delta_kb(rss);
+  const auto destroy_start = Clock::now();
+  for (T * e : entities) {
+    destroy(e);
+  }
+  return JsonObject()
+         .add("count", count)
+         .add("create_ms", create_ms)
+         .add("create_per_entity_us", count ? 1000 * create_ms / count : 0.0)
+         .add("rss_delta_kb", rss_delta)
+         .add("rss_per_entity_kb", count ? static_cast<double>(rss_delta) / count : 0.0)
+         .add("destroy_ms", benchmark::elapsed_ms(destroy_start));
+}
+
+std::string name(const char * prefix, size_t i)
+{
+  return std::string("/benchmark_startup/") + prefix + std::to_string(i);
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  return benchmark::run([argc, argv]() {
+    const benchmark::Args args(argc, argv);
+    const size_t count = args.get("count", size_t(100));
+    const std::chrono::milliseconds timeout(args.get("timeout_ms", size_t(30000)));
+    const auto msg_ts = rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::UnboundedSequences>();
+    const auto srv_ts = rosidl_typesupport_cpp::get_service_type_support_handle<test_msgs::srv::BasicTypes>();
+    const rmw_qos_profile_t qos = rmw_qos_profile_default;
+    const rmw_publisher_options_t pub_options = rmw_get_default_publisher_options();
+    const rmw_subscription_options_t sub_options = rmw_get_default_subscription_options();
+
+    JsonObject result;
+    result.add("benchmark", "startup").add("count", count);
+
+    size_t rss = benchmark::rss_kb();
+    auto start = Clock::now();
+    benchmark::Context context(args.get("domain", size_t(0)));
+    result.add("rmw_init", JsonObject()
+      .add("ms", benchmark::elapsed_ms(start))
+      .add("rss_delta_kb", benchmark::rss_delta_kb(rss)));
+
+    rss = benchmark::rss_kb();
+    start = Clock::now();
+    std::unique_ptr<benchmark::Node> node(new benchmark::Node(context, "benchmark_startup"));
+    result.add("rmw_create_node", JsonObject()
+      .add("ms", benchmark::elapsed_ms(start))
+      .add("rss_delta_kb", benchmark::rss_delta_kb(rss)));
+    rmw_node_t * n = node->get();
+
+    const std::function<void(rmw_publisher_t *)> destroy_pub = [n](rmw_publisher_t * p) {
+        rmw_destroy_publisher(n, p);
+      };
+    const std::function<rmw_publisher_t *(size_t)> create_pub = [&](size_t i) {
+        return benchmark::check(rmw_create_publisher(n, msg_ts, name("pub", i).c_str(), &qos, &pub_options),
+                 "rmw_create_publisher");
+      };
+    result.add("publishers", measure(count, create_pub, destroy_pub));
+    result.add("publishers_same_topic", measure<rmw_publisher_t>(count, [&](size_t) {
+        return create_pub(0);
+      }, destroy_pub));
+
+    result.add("publishers_batched", measure<rmw_publisher_t>(count, [&](size_t i) {
+        if (i == 0) {
+          benchmark::check(rmw_opendds_begin_entity_batch(n), "rmw_opendds_begin_entity_batch");
+        }
+        rmw_publisher_t * p = create_pub(i);
+        if (i + 1 == count) {
+          benchmark::check(rmw_opendds_end_entity_batch(n), "rmw_opendds_end_entity_batch");
+        }
+        return p;
+      }, destroy_pub));
+
+    result.add("subscriptions", measure<rmw_subscription_t>(count, [&](size_t i) {
+        return benchmark::check(rmw_create_subscription(n, msg_ts, name("sub", i).c_str(), &qos, &sub_options),
+                 "rmw_create_subscription");
+      }, [n](rmw_subscription_t * s) {
+        rmw_destroy_subscription(n, s);
+      }));
+
+    result.add("services", measure<rmw_service_t>(count, [&](size_t i) {
+        return benchmark::check(rmw_create_service(n, srv_ts, name("srv", i).c_str(), &qos),
+                 "rmw_create_service");
+      }, [n](rmw_service_t * s) {
+        rmw_destroy_service(n, s);
+      }));
+
+    result.add("clients", measure<rmw_client_t>(count, [&](size_t i) {
+        return benchmark::check(rmw_create_client(n, srv_ts, name("srv", i).c_str(), &qos),
+                 "rmw_create_client");
+      }, [n](rmw_client_t * c) {
+        rmw_destroy_client(n, c);
+      }));
+
+    // discovery between two local nodes
+    benchmark::Node other(context, "benchmark_startup_other");
+    const std::string topic = "/benchmark_startup/match";
+    rmw_publisher_t * pub = benchmark::check(
+      rmw_create_publisher(n, msg_ts, topic.c_str(), &qos, &pub_options), "rmw_create_publisher");
+    start = Clock::now();
+    rmw_subscription_t * sub = benchmark::check(
+      rmw_create_subscription(other.get(), msg_ts, topic.c_str(), &qos, &sub_options), "rmw_create_subscription");
+    const bool matched = benchmark::wait_until([&]() {
+          size_t subscribers = 0;
+          return rmw_count_subscribers(n, topic.c_str(), &subscribers) == RMW_RET_OK && subscribers > 0;
+        }, timeout);
+    result.add("match", JsonObject()
+      .add("matched", matched)
+      .add("ms", benchmark::elapsed_ms(start)));
+    rmw_destroy_subscription(other.get(), sub);
+    rmw_destroy_publisher(n, pub);
+
+    rss = benchmark::rss_kb();
+    start = Clock::now();
+    node.reset();
+    result.add("rmw_destroy_node", JsonObject()
+      .add("ms", benchmark::elapsed_ms(start))
+      .add("rss_delta_kb", benchmark::rss_delta_kb(rss)));
+
+    benchmark::emit(args, result);
+  });
+}
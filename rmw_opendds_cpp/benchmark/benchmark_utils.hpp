@@ -0,0 +1,338 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__BENCHMARK__BENCHMARK_UTILS_HPP_
+#define RMW_OPENDDS_CPP__BENCHMARK__BENCHMARK_UTILS_HPP_
+
+#include <rcutils/allocator.h>
+
+#include <rmw/error_handling.h>
+#include <rmw/init.h>
+#include <rmw/init_options.h>
+#include <rmw/rmw.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Helpers shared by the rmw_opendds_cpp benchmarks. Every benchmark runs its
+// nodes in a single process on the domain given by --domain and prints one JSON
+// object to stdout (or to the file given by --output).
+namespace benchmark
+{
+
+typedef std::chrono::steady_clock Clock;
+
+inline double elapsed_us(Clock::time_point start, Clock::time_point end = Clock::now())
+{
+  return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+inline double elapsed_ms(Clock::time_point start, Clock::time_point end = Clock::now())
+{
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+inline int64_t now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// Resident set size of the process in KiB; 0 where /proc is not available.
+inline size_t rss_kb()
+{
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmRSS:") == 0) {
+      return std::strtoul(line.c_str() + 6, nullptr, 10);
+    }
+  }
+  return 0;
+}
+
+inline int64_t rss_delta_kb(size_t before)
+{
+  return static_cast<int64_t>(rss_kb()) - static_cast<int64_t>(before);
+}
+
+inline void check(rmw_ret_t ret, const std::string & what)
+{
+  if (ret != RMW_RET_OK) {
+    const std::string msg = what + " failed: " + rmw_get_error_string().str;
+    rmw_reset_error();
+    throw std::runtime_error(msg);
+  }
+}
+
+template<typename T>
+T * check(T * ptr, const std::string & what)
+{
+  if (!ptr) {
+    const std::string msg = what + " failed: " + rmw_get_error_string().str;
+    rmw_reset_error();
+    throw std::runtime_error(msg);
+  }
+  return ptr;
+}
+
+// Poll pred until it returns true; return false on timeout.
+inline bool wait_until(const std::function<bool()> & pred, std::chrono::milliseconds timeout,
+  std::chrono::microseconds period = std::chrono::microseconds(100))
+{
+  const auto deadline = Clock::now() + timeout;
+  while (!pred()) {
+    if (Clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(period);
+  }
+  return true;
+}
+
+class JsonObject
+{
+public:
+  template<typename T>
+  typename std::enable_if<std::is_arithmetic<T>::value, JsonObject &>::type
+  add(const std::string & key, T value)
+  {
+    std::ostringstream s;
+    s << value;
+    return add_raw(key, s.str());
+  }
+  JsonObject & add(const std::string & key, bool value) { return add_raw(key, value ? "true" : "false"); }
+  JsonObject & add(const std::string & key, const char * value) { return add(key, std::string(value)); }
+  JsonObject & add(const std::string & key, const std::string & value) { return add_raw(key, quote(value)); }
+  JsonObject & add(const std::string & key, const JsonObject & value) { return add_raw(key, value.str()); }
+  JsonObject & add(const std::string & key, const std::vector<JsonObject> & values)
+  {
+    std::string s = "[";
+    for (size_t i = 0; i < values.size(); ++i) {
+      s += (i ? "," : "") + values[i].str();
+    }
+    return add_raw(key, s + "]");
+  }
+  std::string str() const
+  {
+    std::string s = "{";
+    for (size_t i = 0; i < members_.size(); ++i) {
+      s += (i ? "," : "") + quote(members_[i].first) + ":" + members_[i].second;
+    }
+    return s + "}";
+  }
+
+private:
+  JsonObject & add_raw(const std::string & key, const std::string & value)
+  {
+    members_.emplace_back(key, value);
+    return *this;
+  }
+  static std::string quote(const std::string & s)
+  {
+    std::string q = "\"";
+    for (char c : s) {
+      if (c == '"' || c == '\\') {
+        q += '\\';
+      }
+      q += c;
+    }
+    return q + '"';
+  }
+  std::vector<std::pair<std::string, std::string>> members_;
+};
+
+// Latency percentiles in microseconds.
+inline JsonObject percentiles(std::vector<double> samples_us)
+{
+  JsonObject o;
+  o.add("samples", samples_us.size());
+  if (samples_us.empty()) {
+    return o;
+  }
+  std::sort(samples_us.begin(), samples_us.end());
+  const auto at = [&samples_us](double q) {
+      return samples_us[std::min(samples_us.size() - 1, static_cast<size_t>(q * samples_us.size()))];
+    };
+  double sum = 0;
+  for (double v : samples_us) {
+    sum += v;
+  }
+  return o.add("min_us", samples_us.front())
+         .add("mean_us", sum / samples_us.size())
+         .add("p50_us", at(0.5))
+         .add("p99_us", at(0.99))
+         .add("p999_us", at(0.999))
+         .add("max_us", samples_us.back());
+}
+
+// --name=value command line options.
+class Args
+{
+public:
+  Args(int argc, char ** argv) : args_(argv + 1, argv + argc) {}
+  std::string get(const std::string & name, const std::string & def) const
+  {
+    const std::string prefix = "--" + name + "=";
+    for (const auto & a : args_) {
+      if (a.compare(0, prefix.size(), prefix) == 0) {
+        return a.substr(prefix.size());
+      }
+    }
+    return def;
+  }
+  size_t get(const std::string & name, size_t def) const
+  {
+    const std::string v = get(name, std::string());
+    return v.empty() ? def : std::strtoul(v.c_str(), nullptr, 10);
+  }
+  std::vector<size_t> get_list(const std::string & name, const std::vector<size_t> & def) const
+  {
+    const std::string v = get(name, std::string());
+    if (v.empty()) {
+      return def;
+    }
+    std::vector<size_t> list;
+    std::istringstream s(v);
+    std::string item;
+    while (std::getline(s, item, ',')) {
+      list.push_back(std::strtoul(item.c_str(), nullptr, 10));
+    }
+    return list;
+  }
+
+private:
+  std::vector<std::string> args_;
+};
+
+inline void emit(const Args & args, const JsonObject & result)
+{
+  const std::string output = args.get("output", std::string());
+  if (output.empty()) {
+    std::cout << result.str() << std::endl;
+    return;
+  }
+  std::ofstream file(output);
+  file << result.str() << std::endl;
+  if (!file) {
+    throw std::runtime_error("failed to write " + output);
+  }
+}
+
+class Context
+{
+public:
+  explicit Context(size_t domain_id)
+  : options_(rmw_get_zero_initialized_init_options())
+  , context_(rmw_get_zero_initialized_context())
+  {
+    check(rmw_init_options_init(&options_, rcutils_get_default_allocator()), "rmw_init_options_init");
+    options_.domain_id = domain_id;
+    check(rmw_init(&options_, &context_), "rmw_init");
+  }
+  ~Context()
+  {
+    rmw_shutdown(&context_);
+    rmw_context_fini(&context_);
+    rmw_init_options_fini(&options_);
+  }
+  Context(const Context &) = delete;
+  Context & operator=(const Context &) = delete;
+  rmw_context_t * get() { return &context_; }
+
+private:
+  rmw_init_options_t options_;
+  rmw_context_t context_;
+};
+
+class Node
+{
+public:
+  Node(Context & context, const std::string & name)
+  : node_(check(rmw_create_node(context.get(), name.c_str(), "/", context.get()->options.domain_id, true),
+      "rmw_create_node"))
+  {}
+  ~Node() { rmw_destroy_node(node_); }
+  Node(const Node &) = delete;
+  Node & operator=(const Node &) = delete;
+  rmw_node_t * get() const { return node_; }
+
+private:
+  rmw_node_t * node_;
+};
+
+class WaitSet
+{
+public:
+  WaitSet(Context & context, size_t max_conditions)
+  : wait_set_(check(rmw_create_wait_set(context.get(), max_conditions), "rmw_create_wait_set"))
+  {}
+  ~WaitSet() { rmw_destroy_wait_set(wait_set_); }
+  WaitSet(const WaitSet &) = delete;
+  WaitSet & operator=(const WaitSet &) = delete;
+  rmw_wait_set_t * get() const { return wait_set_; }
+
+  // Wait for any of subs to have data; return the indexes of those that are ready.
+  std::vector<size_t> wait(const std::vector<rmw_subscription_t *> & subs, std::chrono::nanoseconds timeout)
+  {
+    handles_.resize(subs.size());
+    for (size_t i = 0; i < subs.size(); ++i) {
+      handles_[i] = subs[i]->data;
+    }
+    rmw_subscriptions_t subscriptions = {handles_.size(), handles_.data()};
+    const rmw_time_t t = {static_cast<uint64_t>(timeout.count() / 1000000000),
+                          static_cast<uint64_t>(timeout.count() % 1000000000)};
+    std::vector<size_t> ready;
+    const rmw_ret_t ret = rmw_wait(&subscriptions, nullptr, nullptr, nullptr, nullptr, wait_set_, &t);
+    if (ret == RMW_RET_TIMEOUT) {
+      return ready;
+    }
+    check(ret, "rmw_wait");
+    for (size_t i = 0; i < handles_.size(); ++i) {
+      if (handles_[i]) {
+        ready.push_back(i);
+      }
+    }
+    return ready;
+  }
+
+private:
+  rmw_wait_set_t * wait_set_;
+  std::vector<void *> handles_;
+};
+
+inline int run(const std::function<void()> & benchmark)
+{
+  try {
+    benchmark();
+    return EXIT_SUCCESS;
+  } catch (const std::exception & e) {
+    std::cerr << "benchmark failed: " << e.what() << std::endl;
+  }
+  return EXIT_FAILURE;
+}
+
+}  // namespace benchmark
+
+#endif  // RMW_OPENDDS_CPP__BENCHMARK__BENCHMARK_UTILS_HPP_
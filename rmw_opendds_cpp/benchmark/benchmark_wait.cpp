@@ -0,0 +1,242 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Scalability of rmw_wait with --counts subscriptions, guard conditions,
+// services, clients and events each. For every count it times
+//   - idle: a full rmw_wait cycle (attach, wait, active scan, detach) with nothing ready;
+//   - guard: the cycle when one guard condition is triggered;
+//   - wake: the latency from rmw_publish on the topic of the last subscription
+//     to the return of an rmw_wait blocked on the whole set.
+//
+// Options: --domain=0 --counts=1,10,100,1000,5000 --iterations=1000
+//          --services=1 --events=1 --timeout_ms=10000 --output=<file>
+
+#include "benchmark_utils.hpp"
+
+#include <rmw/event.h>
+#include <rmw/qos_profiles.h>
+
+#include <rosidl_typesupport_cpp/message_type_support.hpp>
+#include <rosidl_typesupport_cpp/service_type_support.hpp>
+
+#include <test_msgs/msg/empty.hpp>
+#include <test_msgs/srv/empty.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace
+{
+
+using benchmark::Clock;
+using benchmark::JsonObject;
+
+class Entities
+{
+public:
+  Entities(benchmark::Context & context, benchmark::Node & node, size_t count, bool services, bool events)
+  : node_(node.get())
+  {
+    const auto msg_ts = rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::Empty>();
+    const auto srv_ts = rosidl_typesupport_cpp::get_service_type_support_handle<test_msgs::srv::Empty>();
+    const rmw_qos_profile_t qos = rmw_qos_profile_default;
+    const rmw_subscription_options_t sub_options = rmw_get_default_subscription_options();
+    for (size_t i = 0; i < count; ++i) {
+      const std::string name = "/benchmark_wait/e" + std::to_string(i);
+      subs.push_back(benchmark::check(
+        rmw_create_subscription(node_, msg_ts, name.c_str(), &qos, &sub_options), "rmw_create_subscription"));
+      gcs.push_back(benchmark::check(rmw_create_guard_condition(context.get()), "rmw_create_guard_condition"));
+      if (services) {
+        srvs.push_back(benchmark::check(rmw_create_service(node_, srv_ts, name.c_str(), &qos), "rmw_create_service"));
+        clients.push_back(benchmark::check(rmw_create_client(node_, srv_ts, name.c_str(), &qos), "rmw_create_client"));
+      }
+      if (events) {
+        std::unique_ptr<rmw_event_t> event(new rmw_event_t(rmw_get_zero_initialized_event()));
+        benchmark::check(rmw_subscription_event_init(event.get(), subs.back(), RMW_EVENT_LIVELINESS_CHANGED),
+          "rmw_subscription_event_init");
+        evs.push_back(std::move(event));
+      }
+    }
+  }
+
+  ~Entities()
+  {
+    for (auto & e : evs) {
+      rmw_event_fini(e.get());
+    }
+    for (auto c : clients) {
+      rmw_destroy_client(node_, c);
+    }
+    for (auto s : srvs) {
+      rmw_destroy_service(node_, s);
+    }
+    for (auto g : gcs) {
+      rmw_destroy_guard_condition(g);
+    }
+    for (auto s : subs) {
+      rmw_destroy_subscription(node_, s);
+    }
+  }
+
+  // One rmw_wait cycle on all entities; handles are rebuilt as an executor does.
+  rmw_ret_t wait(benchmark::WaitSet & wait_set, const rmw_time_t * timeout)
+  {
+    fill(sub_handles_, subs, [](rmw_subscription_t * s) {return s->data;});
+    fill(gc_handles_, gcs, [](rmw_guard_condition_t * g) {return g->data;});
+    fill(srv_handles_, srvs, [](rmw_service_t * s) {return s->data;});
+    fill(client_handles_, clients, [](rmw_client_t * c) {return c->data;});
+    fill(event_handles_, evs, [](const std::unique_ptr<rmw_event_t> & e) {return static_cast<void *>(e.get());});
+    rmw_subscriptions_t s = {sub_handles_.size(), sub_handles_.data()};
+    rmw_guard_conditions_t g = {gc_handles_.size(), gc_handles_.data()};
+    rmw_services_t v = {srv_handles_.size(), srv_handles_.data()};
+    rmw_clients_t c = {client_handles_.size(), client_handles_.data()};
+    rmw_events_t e = {event_handles_.size(), event_handles_.data()};
+    return rmw_wait(&s, &g, &v, &c, &e, wait_set.get(), timeout);
+  }
+
+  bool sub_ready(size_t i) const { return sub_handles_[i] != nullptr; }
+  size_t size() const { return subs.size() + gcs.size() + srvs.size() + clients.size() + evs.size(); }
+
+  std::vector<rmw_subscription_t *> subs;
+  std::vector<rmw_guard_condition_t *> gcs;
+  std::vector<rmw_service_t *> srvs;
+  std::vector<rmw_client_t *> clients;
+  std::vector<std::unique_ptr<rmw_event_t>> evs;
+
+private:
+  template<typename T, typename F>
+  static void fill(std::vector<void *> & handles, const std::vector<T> & entities, F handle)
+  {
+    handles.resize(entities.size());
+    for (size_t i = 0; i < entities.size(); ++i) {
+      handles[i] = handle(entities[i]);
+    }
+  }
+
+  rmw_node_t * node_;
+  std::vector<void *> sub_handles_;
+  std::vector<void *> gc_handles_;
+  std::vector<void *> srv_handles_;
+  std::vector<void *> client_handles_;
+  std::vector<void *> event_handles_;
+};
+
+JsonObject run(benchmark::Context & context, benchmark::Node & node, size_t count, const benchmark::Args & args)
+{
+  const size_t iterations = args.get("iterations", size_t(1000));
+  const std::chrono::milliseconds timeout(args.get("timeout_ms", size_t(10000)));
+  const rmw_time_t zero = {0, 0};
+  const rmw_time_t wake_timeout = {static_cast<uint64_t>(timeout.count() / 1000),
+                                   static_cast<uint64_t>(timeout.count() % 1000) * 1000000};
+
+  auto start = Clock::now();
+  Entities entities(context, node, count, args.get("services", size_t(1)) != 0, args.get("events", size_t(1)) != 0);
+  JsonObject result;
+  result.add("count", count).add("conditions", entities.size()).add("setup_ms", benchmark::elapsed_ms(start));
+  benchmark::WaitSet wait_set(context, entities.size());
+
+  std::vector<double> idle;
+  std::vector<double> guard;
+  for (size_t i = 0; i < iterations; ++i) {
+    start = Clock::now();
+    const rmw_ret_t ret = entities.wait(wait_set, &zero);
+    idle.push_back(benchmark::elapsed_us(start));
+    if (ret != RMW_RET_TIMEOUT && ret != RMW_RET_OK) {
+      benchmark::check(ret, "rmw_wait");
+    }
+
+    benchmark::check(rmw_trigger_guard_condition(entities.gcs[i % count]), "rmw_trigger_guard_condition");
+    start = Clock::now();
+    benchmark::check(entities.wait(wait_set, &wake_timeout), "rmw_wait");
+    guard.push_back(benchmark::elapsed_us(start));
+  }
+  result.add("idle", benchmark::percentiles(idle)).add("guard", benchmark::percentiles(guard));
+
+  // wake latency on the last subscription, the end of every scan
+  const size_t target = count - 1;
+  const auto msg_ts = rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::Empty>();
+  const rmw_qos_profile_t qos = rmw_qos_profile_default;
+  const rmw_publisher_options_t pub_options = rmw_get_default_publisher_options();
+  const std::string topic = "/benchmark_wait/e" + std::to_string(target);
+  rmw_publisher_t * pub = benchmark::check(
+    rmw_create_publisher(node.get(), msg_ts, topic.c_str(), &qos, &pub_options), "rmw_create_publisher");
+  const bool matched = benchmark::wait_until([pub]() {
+        size_t n = 0;
+        return rmw_publisher_count_matched_subscriptions(pub, &n) == RMW_RET_OK && n > 0;
+      }, timeout);
+  result.add("matched", matched);
+
+  std::vector<double> wake;
+  size_t missed = 0;
+  if (matched) {
+    std::atomic<int64_t> published_ns(0);
+    std::atomic<bool> stop(false);
+    std::atomic<size_t> round(0);
+    std::string error;
+    std::thread publisher([&]() {
+        try {
+          test_msgs::msg::Empty msg;
+          for (size_t i = 0; i < iterations && !stop; ++i) {
+            // give the waiting thread time to block in rmw_wait
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            published_ns = benchmark::now_ns();
+            benchmark::check(rmw_publish(pub, &msg, nullptr), "rmw_publish");
+            benchmark::wait_until([&]() {return round > i || stop;}, timeout, std::chrono::microseconds(10));
+          }
+        } catch (const std::exception & e) {
+          error = e.what();
+          stop = true;
+        }
+      });
+    test_msgs::msg::Empty msg;
+    for (size_t i = 0; i < iterations && !stop; ++i) {
+      rmw_ret_t ret = RMW_RET_OK;
+      while ((ret = entities.wait(wait_set, &wake_timeout)) == RMW_RET_OK && !entities.sub_ready(target)) {}
+      const int64_t woke_ns = benchmark::now_ns();
+      if (ret == RMW_RET_OK) {
+        wake.push_back((woke_ns - published_ns) / 1000.0);
+        bool taken = false;
+        benchmark::check(rmw_take(entities.subs[target], &msg, &taken, nullptr), "rmw_take");
+      } else {
+        ++missed;
+      }
+      round = i + 1;
+    }
+    stop = true;
+    publisher.join();
+    if (!error.empty()) {
+      throw std::runtime_error(error);
+    }
+  }
+  rmw_destroy_publisher(node.get(), pub);
+  return result.add("wake", benchmark::percentiles(wake).add("missed", missed));
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  return benchmark::run([argc, argv]() {
+    const benchmark::Args args(argc, argv);
+    benchmark::Context context(args.get("domain", size_t(0)));
+    benchmark::Node node(context, "benchmark_wait");
+    std::vector<JsonObject> results;
+    for (size_t count : args.get_list("counts", {1, 10, 100, 1000, 5000})) {
+      if (count > 0) {
+        results.push_back(run(context, node, count, args));
+      }
+    }
+    benchmark::emit(args, JsonObject().add("benchmark", "wait").add("results", results));
+  });
+}
@@ -0,0 +1,63 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__ASYNCWRITER_HPP_
+#define RMW_OPENDDS_CPP__ASYNCWRITER_HPP_
+
+#include <rmw_opendds_cpp/bounded_queue.hpp>
+
+#include <rcutils/types/uint8_array.h>
+
+#include <rmw/types.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+class DDSPublisher;
+
+// Writes the serialized messages of a DDSPublisher on a thread of its own.
+class AsyncWriter
+{
+public:
+  AsyncWriter(DDSPublisher & pub, size_t depth, int cpu);
+  // Writes the messages still queued before returning.
+  ~AsyncWriter();
+  AsyncWriter(const AsyncWriter &) = delete;
+  AsyncWriter & operator=(const AsyncWriter &) = delete;
+
+  // Queue cdr_stream and take its buffer, or fail with RMW_RET_ERROR if the queue is full:
+  // the message is then not published, and counted as dropped.
+  rmw_ret_t push(const rmw_publisher_t * publisher, rcutils_uint8_array_t & cdr_stream);
+
+private:
+  struct Message
+  {
+    const rmw_publisher_t * publisher;
+    rcutils_uint8_array_t cdr_stream;
+  };
+  void run();
+  void write(Message & message);
+
+  DDSPublisher & pub_;
+  BoundedQueue<Message> queue_;
+  std::atomic<bool> stop_;
+  std::atomic<bool> sleeping_;
+  std::mutex lock_;
+  std::condition_variable cv_;
+  std::thread thread_;
+};
+
+#endif  // RMW_OPENDDS_CPP__ASYNCWRITER_HPP_
@@ -38,7 +38,7 @@ public:
 private:
   friend Raf;
   DDSClient(const rosidl_service_type_support_t * ts, const char * service_name,
-            const rmw_qos_profile_t * rmw_qos, DDS::DomainParticipant_var dp);
+            const rmw_qos_profile_t * rmw_qos, OpenDDSNode * node);
   ~DDSClient() { cleanup(); }
   void cleanup();
   bool count_matched_subscribers(size_t & count) const;
@@ -17,11 +17,20 @@
 
 #include <rmw_opendds_cpp/DDSEntity.hpp>
 #include <rmw_opendds_cpp/DDSTopic.hpp>
+#include <rmw_opendds_cpp/EntityStats.hpp>
 #include <rmw_opendds_cpp/RmwAllocateFree.hpp>
+#include <rmw_opendds_cpp/publisher_options.h>
 
 #include <atomic>
+#include <mutex>
 
-class OpenDDSPublisherListener : public DDS::PublisherListener
+class AsyncWriter;
+class DeltaEncoder;
+class OpenDDSNode;
+namespace OpenDDS { namespace DCPS { class EntityImpl; } }
+
+// Listener of the DataWriter of a DDSPublisher.
+class OpenDDSPublisherListener : public DDS::DataWriterListener
 {
 public:
   typedef RmwAllocateFree<OpenDDSPublisherListener> Raf;
@@ -52,10 +61,33 @@ public:
   rmw_ret_t get_rmw_qos(rmw_qos_profile_t & qos) const;
   rmw_ret_t to_cdr_stream(const void * ros_message, rcutils_uint8_array_t & cdr_stream);
   DDS::DataWriter_var writer() const { return writer_; }
+  // Write a serialized message; publisher is the handle traced and cdr_stream is not kept.
+  // RMW_RET_TIMEOUT when the history stayed full for the max blocking time.
+  rmw_ret_t write(const rmw_publisher_t * publisher, const rcutils_uint8_array_t & cdr_stream);
+  // Write a sample with a source timestamp, or the current time if null.
+  rmw_ret_t write(const rmw_publisher_t * publisher, const OpenDDSStaticSerializedData & sample,
+                  const DDS::Time_t * source_timestamp);
+  // Write count messages, stopping at the first failure; written is set to the number of
+  // messages written. Only a batch publisher, which has a DDS publisher of its own, writes
+  // them together.
+  rmw_ret_t write_batch(const rmw_publisher_t * publisher, const rcutils_uint8_array_t * cdr_streams,
+                        std::size_t count, std::size_t & written);
+  AsyncWriter * async_writer() const { return async_; }
+  rmw_opendds_compression_t compression() const { return compression_; }
+  bool delta() const { return delta_ != nullptr; }
+  // see rmw_opendds_get_publisher_unacknowledged_estimate
+  std::size_t unacknowledged_estimate();
 
   std::size_t matched_subscribers() const { return listener_->current_count(); }
-  DDS::InstanceHandle_t instance_handle() const { return publisher_->get_instance_handle(); }
-  rmw_gid_t gid() const { return publisher_gid_; }
+  // A volatile sample written with no matched subscription is never delivered, so it need
+  // not be serialized nor written; manual by topic liveliness is only asserted by writes.
+  bool can_skip_publish() const { return skippable_ && matched_subscribers() == 0; }
+  // An error while the writer is disabled, until the entity batch it was created in ends;
+  // checked before skipping, as a disabled writer is unmatched.
+  rmw_ret_t check_enabled() const;
+  DDS::InstanceHandle_t instance_handle() const { return writer_->get_instance_handle(); }
+  rmw_gid_t gid() const;
+  PublisherStats & stats() { return stats_; }
 
   // Remap the OpenDDS DataWriter status to a generic RMW status
   rmw_ret_t get_status(const DDS::StatusMask mask, void * rmw_status) override;
@@ -63,16 +95,34 @@ public:
   DDS::Entity * get_entity() override { return writer_; }
 private:
   friend Raf;
-  DDSPublisher(DDS::DomainParticipant_var dp, const rosidl_message_type_support_t * ros_ts,
-               const char * topic_name, const rmw_qos_profile_t * rmw_qos);
+  // ros_ts, or null for a generic publisher of type_name
+  DDSPublisher(OpenDDSNode * node, const rosidl_message_type_support_t * ros_ts, const char * type_name,
+               const char * topic_name, const rmw_qos_profile_t * rmw_qos,
+               const rmw_opendds_publisher_options_t * options);
   ~DDSPublisher() { cleanup(); }
   void cleanup();
 
+  OpenDDSNode * node_;
   DDSTopic topic_;
   OpenDDSPublisherListener * listener_;
+  // shared by the node, or of this publisher only for a batch publisher
   DDS::Publisher_var publisher_;
+  bool own_publisher_;
   DDS::DataWriter_var writer_;
-  rmw_gid_t publisher_gid_;
+  OpenDDS::DCPS::EntityImpl * writer_impl_;
+  DDS::UserDataQosPolicy user_data_;
+  PublisherStats stats_;
+  bool skippable_;
+  AsyncWriter * async_;
+  // writes not yet known to be acknowledged, and their bound (0: none)
+  std::atomic<std::size_t> unacknowledged_;
+  std::size_t unacknowledged_max_;
+  rmw_opendds_compression_t compression_;
+  std::size_t compression_threshold_;
+  int compression_level_;
+  // held from encoding a delta frame until it is written
+  std::mutex delta_lock_;
+  DeltaEncoder * delta_;
 };
 
 #endif  // RMW_OPENDDS_CPP__DDSPUBLISHER_HPP_
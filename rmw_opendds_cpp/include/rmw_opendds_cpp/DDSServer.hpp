@@ -37,7 +37,7 @@ public:
 private:
   friend Raf;
   DDSServer(const rosidl_service_type_support_t * ts, const char * service_name,
-            const rmw_qos_profile_t * rmw_qos, DDS::DomainParticipant_var dp);
+            const rmw_qos_profile_t * rmw_qos, OpenDDSNode * node);
   ~DDSServer() { cleanup(); }
   void cleanup();
 
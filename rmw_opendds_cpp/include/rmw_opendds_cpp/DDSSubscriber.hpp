@@ -17,18 +17,31 @@
 
 #include <rmw_opendds_cpp/DDSEntity.hpp>
 #include <rmw_opendds_cpp/DDSTopic.hpp>
+#include <rmw_opendds_cpp/EntityStats.hpp>
+#include <rmw_opendds_cpp/guid_helper.hpp>
 #include <rmw_opendds_cpp/RmwAllocateFree.hpp>
+#include <rmw_opendds_cpp/subscription_filter.h>
+#include <rmw_opendds_cpp/subscription_options.h>
 
 #include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
-class OpenDDSSubscriberListener : public DDS::SubscriberListener
+class DDSSubscriber;
+class DeltaDecoder;
+class OpenDDSNode;
+
+// Listener of the DataReader of a DDSSubscriber; the DDS subscriber is shared by the node.
+class OpenDDSSubscriberListener : public DDS::DataReaderListener
 {
 public:
   typedef RmwAllocateFree<OpenDDSSubscriberListener> Raf;
 
-  virtual void on_subscription_matched(DDS::DataReader *, const DDS::SubscriptionMatchedStatus & status) {
-    current_count_ = status.current_count;
-  }
+  // Set before the reader is created: its matched publications are updated from here.
+  void set_subscriber(DDSSubscriber * subscriber) { subscriber_ = subscriber; }
+  virtual void on_subscription_matched(DDS::DataReader * reader, const DDS::SubscriptionMatchedStatus & status);
   std::size_t current_count() const {
     return current_count_;
   }
@@ -50,13 +63,11 @@ public:
   void on_sample_lost(DDS::DataReader_ptr, const DDS::SampleLostStatus&) {
     ACE_DEBUG((LM_DEBUG, ACE_TEXT("%N:%l: INFO: on_sample_lost()\n")));
   }
-  void on_data_on_readers(DDS::Subscriber_ptr) {
-    ACE_DEBUG((LM_DEBUG, ACE_TEXT("%N:%l: INFO: on_data_on_readers()\n")));
-  }
 private:
   friend Raf;
-  OpenDDSSubscriberListener() { current_count_ = 0; }
+  OpenDDSSubscriberListener() : subscriber_(nullptr) { current_count_ = 0; }
   ~OpenDDSSubscriberListener() {}
+  DDSSubscriber * subscriber_;
   std::atomic<std::size_t> current_count_;
 };
 
@@ -71,7 +82,33 @@ public:
   rmw_ret_t to_ros_message(const rcutils_uint8_array_t & cdr_stream, void * ros_message);
   DDS::ReadCondition_var read_condition() const { return read_condition_; }
   std::size_t matched_publishers() const { return listener_->current_count(); }
-  DDS::InstanceHandle_t instance_handle() const { return subscriber_->get_instance_handle(); }
+  DDS::InstanceHandle_t instance_handle() const { return reader_->get_instance_handle(); }
+  SubscriberStats & stats() { return stats_; }
+  rmw_opendds_compression_t compression() const { return compression_; }
+  size_t max_decompressed_size() const { return max_decompressed_size_; }
+  // Rebuilds the messages of delta encoding publishers, null if the subscription does not match them.
+  DeltaDecoder * delta() const { return delta_; }
+  // Samples the filter rejects are dropped by take() before they are copied or deserialized.
+  // Safe while other threads take: a take already running may still use the previous filter.
+  void set_filter(rmw_opendds_sample_filter_t filter, void * arg);
+  bool filtering() const { return filter_.load(std::memory_order_acquire) != nullptr; }
+  bool accepts(const uint8_t * cdr, size_t length) const {
+    const Filter * filter = filter_.load(std::memory_order_acquire);
+    return !filter || filter->function(cdr, length, filter->arg);
+  }
+  // Set the TIME_BASED_FILTER of the reader; unsupported for delta encoded subscriptions.
+  rmw_ret_t set_minimum_separation(const rmw_time_t & separation);
+  // GUID of the writer of a sample, resolved when the writer was matched.
+  DDS::GUID_t publisher_guid(DDS::InstanceHandle_t publication_handle) const;
+  // Resolve the writers of newly matched publications and forget the unmatched ones, and
+  // the delta decoding state of those.
+  void update_publications(DDS::DataReader * reader);
+  // The latency histogram is created when first enabled and kept until the subscriber is destroyed.
+  void enable_latency_histogram(bool enable);
+  LatencyHistogram * latency_histogram() const { return latency_.load(std::memory_order_acquire); }
+  LatencyHistogram * recording_latency_histogram() const {
+    return latency_enabled_.load(std::memory_order_relaxed) ? latency_histogram() : nullptr;
+  }
 
   // Remap the specific OpenDDS DataReader status to a generic RMW status
   rmw_ret_t get_status(const DDS::StatusMask mask, void * rmw_status) override;
@@ -79,17 +116,47 @@ public:
   DDS::Entity * get_entity() override { return reader_; }
 private:
   friend Raf;
-  DDSSubscriber(DDS::DomainParticipant_var dp, const rosidl_message_type_support_t * ros_ts,
-                const char * topic_name, const rmw_qos_profile_t * rmw_qos);
+  // ros_ts, or null for a generic subscription of type_name
+  DDSSubscriber(OpenDDSNode * node, const rosidl_message_type_support_t * ros_ts, const char * type_name,
+                const char * topic_name, const rmw_qos_profile_t * rmw_qos,
+                const rmw_opendds_subscription_options_t * options);
   ~DDSSubscriber() { cleanup(); }
   void cleanup();
 
+  OpenDDSNode * node_;
   DDSTopic topic_;
   OpenDDSSubscriberListener * listener_;
   DDS::Subscriber_var subscriber_;
   DDS::DataReader_var reader_;
   DDS::ReadCondition_var read_condition_;
+  DDS::UserDataQosPolicy user_data_;
   bool ignore_local_publications;
+  SubscriberStats stats_;
+  std::atomic<LatencyHistogram *> latency_;
+  std::atomic<bool> latency_enabled_;
+  struct Filter
+  {
+    rmw_opendds_sample_filter_t function;
+    void * arg;
+  };
+  // every filter set is kept, so that filter_ is never left pointing to a freed one
+  std::mutex filters_lock_;
+  std::list<Filter> filters_;
+  std::atomic<const Filter *> filter_;
+  rmw_opendds_compression_t compression_;
+  size_t max_decompressed_size_;
+  DeltaDecoder * delta_;
+  // Replaced as a whole, under publications_lock_, when the matched publications change,
+  // so that take() reads it with std::atomic_load and without a lock.
+  typedef std::unordered_map<DDS::InstanceHandle_t, DDS::GUID_t> PublisherGuids;
+  std::mutex publications_lock_;
+  std::shared_ptr<const PublisherGuids> publisher_guids_;
 };
 
+// Source timestamp of a sample, on the clock of wall_now_ns().
+inline int64_t source_timestamp_ns(const DDS::SampleInfo & info)
+{
+  return static_cast<int64_t>(info.source_timestamp.sec) * 1000000000 + info.source_timestamp.nanosec;
+}
+
 #endif  // RMW_OPENDDS_CPP__DDSSUBSCRIBER_HPP_
@@ -21,12 +21,19 @@
 
 #include <string>
 
+class OpenDDSNode;
+
+// DDSTopic holds a reference to a Topic shared by all endpoints of the node's participant.
+// Every topic carries serialized messages: without type support, the topic of a generic
+// endpoint is named after type_name and has no callbacks.
 class DDSTopic
 {
 public:
-  DDSTopic(const rosidl_message_type_support_t * ts, const char * topic_name,
-           const rmw_qos_profile_t * rmw_qos, DDS::DomainParticipant_var dp);
+  DDSTopic(const rosidl_message_type_support_t * ts, const char * type_name, const char * topic_name,
+           const rmw_qos_profile_t * rmw_qos, OpenDDSNode * node);
   ~DDSTopic();
+  DDSTopic(const DDSTopic &) = delete;
+  DDSTopic & operator=(const DDSTopic &) = delete;
   const message_type_support_callbacks_t * callbacks() const { return cb_; }
   const std::string& name() const { return name_; }
   const std::string& type() const { return type_; }
@@ -36,13 +43,12 @@ private:
   const rosidl_message_type_support_t & get_type_support(const rosidl_message_type_support_t * mts) const;
   const message_type_support_callbacks_t * get_callbacks(const rosidl_message_type_support_t * mts) const;
   std::string create_topic_name(const char * topic_name, const rmw_qos_profile_t * rmw_qos) const;
-  std::string create_type_name() const;
-  void register_type(DDS::DomainParticipant_var dp);
-  void find_or_create_topic(DDS::DomainParticipant_var dp);
+  std::string create_type_name(const char * type_name) const;
 
   const message_type_support_callbacks_t * cb_;
   const std::string name_;
   const std::string type_;
+  OpenDDSNode * node_;
   DDS::Topic_var topic_;
 };
 
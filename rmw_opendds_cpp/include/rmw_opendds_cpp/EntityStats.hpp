@@ -0,0 +1,124 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__ENTITYSTATS_HPP_
+#define RMW_OPENDDS_CPP__ENTITYSTATS_HPP_
+
+#include <rmw_opendds_cpp/entity_stats.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+// A relaxed counter padded to a cache line, so that the counters updated by
+// the threads publishing or taking on different entities never share a line.
+// Padded rather than aligned: entities are allocated with rmw_allocate.
+class StatCounter
+{
+public:
+  StatCounter() : value_(0) {}
+  void add(uint64_t n) { value_.fetch_add(n, std::memory_order_relaxed); }
+  uint64_t get() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+  static const size_t cache_line = 64;
+  std::atomic<uint64_t> value_;
+  char pad_[cache_line - sizeof(std::atomic<uint64_t>)];
+};
+
+inline uint64_t stats_now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Time on the clock of DDS source timestamps.
+inline int64_t wall_now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+struct PublisherStats
+{
+  StatCounter messages;
+  StatCounter bytes;
+  StatCounter serialize_ns;
+  StatCounter write_ns;
+  StatCounter write_failures;
+  StatCounter write_timeouts;
+  StatCounter skipped;
+  StatCounter dropped;
+  StatCounter allocation_failures;
+
+  void get(rmw_opendds_publisher_stats_t & stats) const;
+};
+
+struct SubscriberStats
+{
+  StatCounter messages;
+  StatCounter bytes;
+  StatCounter take_ns;
+  StatCounter deserialize_ns;
+  StatCounter take_misses;
+  StatCounter filtered;
+  StatCounter delta_gaps;
+  StatCounter allocation_failures;
+
+  void get(rmw_opendds_subscription_stats_t & stats) const;
+};
+
+// Log-linear histogram of latencies in nanoseconds: values below 16 have a bucket
+// each, and every power of two range above is split into 16 buckets. Recording
+// is lock-free; a reset racing with record() may lose the samples in flight.
+class LatencyHistogram
+{
+public:
+  LatencyHistogram();
+  void record(int64_t ns);
+  void reset();
+  void get(rmw_opendds_latency_stats_t & stats) const;
+
+private:
+  static const unsigned sub_bucket_bits = 4;
+  static const size_t sub_buckets = 1 << sub_bucket_bits;
+  static const size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_buckets;
+  static size_t index(uint64_t ns);
+  static uint64_t lowest(size_t i);
+  int64_t percentile(double q, uint64_t count) const;
+
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> negative_;
+  std::atomic<uint64_t> sum_;
+  std::atomic<int64_t> min_;
+  std::atomic<int64_t> max_;
+  std::atomic<uint64_t> buckets_[bucket_count];
+};
+
+// Whether RMW_OPENDDS_LATENCY_HISTOGRAMS enables the histograms of new subscriptions.
+bool latency_histograms_from_env();
+
+// Publishers and subscribers add their statistics here while they exist.
+// When RMW_OPENDDS_STATS_PERIOD_MS is set to a positive value, a thread logs
+// the statistics of every entity with that period.
+class StatsDump
+{
+public:
+  static void add(const std::string & topic, const PublisherStats & stats);
+  static void add(const std::string & topic, const SubscriberStats & stats);
+  static void remove(const PublisherStats & stats);
+  static void remove(const SubscriberStats & stats);
+};
+
+#endif  // RMW_OPENDDS_CPP__ENTITYSTATS_HPP_
@@ -16,6 +16,7 @@
 #define RMW_OPENDDS_CPP__OPENDDSNODE_HPP_
 
 #include <rmw_opendds_cpp/RmwAllocateFree.hpp>
+#include <rmw_opendds_cpp/StaticDiscoveryConfig.hpp>
 #include <rmw_opendds_cpp/types.hpp>
 
 #include <dds/DCPS/DomainParticipantImpl.h>
@@ -23,8 +24,10 @@
 #include <rmw/names_and_types.h>
 
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 class OpenDDSNode
 {
@@ -40,10 +43,33 @@ public:
   CustomPublisherListener * pub_listener() const { return pub_listener_; }
   CustomSubscriberListener * sub_listener() const { return sub_listener_; }
   DDS::DomainParticipant_var dp() { return dp_; }
-  void add_pub(const DDS::InstanceHandle_t & pub, const std::string & topic_name, const std::string & type_name);
-  void add_sub(const DDS::InstanceHandle_t & sub, const std::string & topic_name, const std::string & type_name);
-  bool remove_pub(const DDS::InstanceHandle_t & pub);
-  bool remove_sub(const DDS::InstanceHandle_t & sub);
+  // GUID of a local entity or of a discovered remote one; GUID_UNKNOWN if there is none.
+  DDS::GUID_t guid(DDS::InstanceHandle_t handle) const { return dpi_->get_repoid(handle); }
+  // Enable a new writer or reader and add it to the graph; deferred until end_batch() in a batch.
+  void add_pub(DDS::Entity * writer, const std::string & topic_name, const std::string & type_name);
+  void add_sub(DDS::Entity * reader, const std::string & topic_name, const std::string & type_name);
+  bool remove_pub(DDS::Entity * writer);
+  bool remove_sub(DDS::Entity * reader);
+  // Endpoints created between begin_batch() and end_batch() stay disabled and are
+  // enabled, announced and added to the graph together by end_batch(). end_batch() ends
+  // the batch even when it throws, naming the topics of the entities it failed to enable.
+  void begin_batch();
+  void end_batch();
+  // With static discovery, put the entity key of a new endpoint in its user_data; no-op otherwise.
+  void set_entity_key(DDS::UserDataQosPolicy & user_data, const std::string & topic_name, EntityType type);
+  void release_entity_key(const DDS::UserDataQosPolicy & user_data);
+  // Topics and their types are registered once per participant and shared by its endpoints.
+  // Each acquire_topic must be paired with a release_topic; the topic is deleted with the last reference.
+  DDS::Topic_var acquire_topic(const std::string & topic_name, const std::string & type_name);
+  void release_topic(const std::string & topic_name);
+  // Endpoints share one DDS publisher and subscriber per partition, deleted with the participant.
+  DDS::Publisher_var publisher(const std::string & partition = std::string());
+  DDS::Subscriber_var subscriber(const std::string & partition = std::string());
+  // A DDS publisher of the partition for one endpoint only, deleted with delete_publisher().
+  DDS::Publisher_var create_publisher(const std::string & partition);
+  void delete_publisher(DDS::Publisher_ptr publisher);
+  // Held while the default QoS of the shared publishers and subscribers is read or changed.
+  std::mutex & default_qos_lock() { return default_qos_lock_; }
   rmw_ret_t count_publishers(const char * topic_name, size_t * count);
   rmw_ret_t count_subscribers(const char * topic_name, size_t * count);
   rmw_ret_t get_names(rcutils_string_array_t * names, rcutils_string_array_t * namespaces, rcutils_string_array_t * enclaves) const;
@@ -58,9 +84,18 @@ private:
   OpenDDSNode(rmw_context_t & context, const char * name, const char * name_space);
   ~OpenDDSNode() { cleanup(); }
   void cleanup();
+  void add_entity(DDS::Entity * entity, const std::string & topic_name, const std::string & type_name, EntityType type);
+  bool remove_entity(DDS::Entity * entity, EntityType type);
+  CustomDataReaderListener * graph_listener(EntityType type) const {
+    return type == EntityType::Publisher ? static_cast<CustomDataReaderListener *>(pub_listener_) : sub_listener_;
+  }
+  void set_autoenable(bool autoenable);
+  DDS::Publisher_var new_publisher(const std::string & partition);
   void set_default_participant_qos();
   bool configureTransport();
   bool match(DDS::UserDataQosPolicy & user_data_qos, const std::string & node_name, const std::string & node_namespace) const;
+  bool find_static_node(const DDS::BuiltinTopicKey_t & key, std::string & node_name, std::string & node_namespace) const;
+  StaticDiscoveryConfig & static_discovery() const;
   rmw_ret_t get_key(DDS::GUID_t & key, const char * node_name, const char * node_namespace) const;
   rmw_ret_t copy_topic_names_types(rmw_names_and_types_t * nt, const NameTypeMap & ntm, bool no_demangle, rcutils_allocator_t * allocator) const;
   rmw_ret_t copy_service_names_types(rmw_names_and_types_t * nt, const NameTypeMap & ntm, rcutils_allocator_t * allocator) const;
@@ -73,6 +108,28 @@ private:
   CustomSubscriberListener * sub_listener_;
   DDS::DomainParticipant_var dp_;
   OpenDDS::DCPS::DomainParticipantImpl * dpi_;
+  StaticDiscoveryConfig::ParticipantId participant_id_;
+  std::string transport_config_;
+  struct TopicRef
+  {
+    DDS::Topic_var topic;
+    std::string type_name;
+    size_t refs;
+  };
+  std::map<std::string, TopicRef> topics_;
+  std::set<std::string> types_;
+  std::map<std::string, DDS::Publisher_var> publishers_;
+  std::map<std::string, DDS::Subscriber_var> subscribers_;
+  std::mutex default_qos_lock_;
+  struct PendingEntity
+  {
+    DDS::Entity_var entity;
+    std::string topic_name;
+    std::string type_name;
+    EntityType type;
+  };
+  bool batching_;
+  std::vector<PendingEntity> pending_;
 
   typedef std::mutex Lock;
   typedef std::lock_guard<Lock> Guard;
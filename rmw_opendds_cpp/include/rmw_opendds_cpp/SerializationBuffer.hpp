@@ -0,0 +1,81 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__SERIALIZATIONBUFFER_HPP_
+#define RMW_OPENDDS_CPP__SERIALIZATIONBUFFER_HPP_
+
+#include <rcutils/allocator.h>
+#include <rcutils/types/uint8_array.h>
+
+#include <algorithm>
+#include <cstddef>
+
+// Serialization buffer of a thread, reused by its synchronous publishes so that large
+// messages do not allocate and fault in a new buffer each time. The serialization only
+// reallocates it for a message larger than its capacity, so that its address is stable
+// while the messages fit. A buffer four times larger than every message of the last
+// shrink_period publishes is freed, so that a single large message does not pin its
+// size for the life of the thread; small buffers are always kept.
+class SerializationBuffer
+{
+public:
+  static const size_t shrink_period = 256;
+  static const size_t min_shrink_capacity = 64 * 1024;
+
+  SerializationBuffer()
+  : cdr_stream_(rcutils_get_zero_initialized_uint8_array())
+  , publishes_(0)
+  , peak_length_(0)
+  {
+    cdr_stream_.allocator = rcutils_get_default_allocator();
+  }
+  ~SerializationBuffer()
+  {
+    free();
+  }
+  SerializationBuffer(const SerializationBuffer &) = delete;
+  SerializationBuffer & operator=(const SerializationBuffer &) = delete;
+
+  rcutils_uint8_array_t & get() { return cdr_stream_; }
+
+  // Account for the message serialized in the buffer once it is written.
+  void release()
+  {
+    peak_length_ = (std::max)(peak_length_, cdr_stream_.buffer_length);
+    cdr_stream_.buffer_length = 0;
+    if (++publishes_ < shrink_period) {
+      return;
+    }
+    if (cdr_stream_.buffer_capacity >= min_shrink_capacity && cdr_stream_.buffer_capacity / 4 > peak_length_) {
+      free();
+    }
+    publishes_ = 0;
+    peak_length_ = 0;
+  }
+
+private:
+  void free()
+  {
+    cdr_stream_.allocator.deallocate(cdr_stream_.buffer, cdr_stream_.allocator.state);
+    cdr_stream_.buffer = nullptr;
+    cdr_stream_.buffer_length = 0;
+    cdr_stream_.buffer_capacity = 0;
+  }
+
+  rcutils_uint8_array_t cdr_stream_;
+  size_t publishes_;
+  size_t peak_length_;
+};
+
+#endif  // RMW_OPENDDS_CPP__SERIALIZATIONBUFFER_HPP_
@@ -19,11 +19,15 @@
 
 #include <dds/DdsDcpsDomainC.h>
 
+#include <string>
+
+class OpenDDSNode;
+
 class Service
 {
 public:
   Service(const rosidl_service_type_support_t * ts, const char * service_name,
-          const rmw_qos_profile_t * rmw_qos, DDS::DomainParticipant_var dp);
+          const rmw_qos_profile_t * rmw_qos, OpenDDSNode * node);
   ~Service() { cleanup(); }
 
   const std::string& name() const { return name_; }
@@ -48,14 +52,19 @@ private:
   const service_type_support_callbacks_t * get_callbacks(const rosidl_service_type_support_t * sts) const;
   const std::string create_request_name(const rmw_qos_profile_t * rmw_qos) const;
   const std::string create_reply_name(const rmw_qos_profile_t * rmw_qos) const;
+  void set_default_qos(const std::string & writer_topic, const std::string & reader_topic);
 
   const service_type_support_callbacks_t * cb_;
   const std::string name_;
   const std::string request_;
   const std::string reply_;
+  const rmw_qos_profile_t qos_;
+  OpenDDSNode * node_;
   DDS::DomainParticipant_var dp_;
   DDS::Publisher_var pub_;
   DDS::Subscriber_var sub_;
+  DDS::UserDataQosPolicy writer_user_data_;
+  DDS::UserDataQosPolicy reader_user_data_;
 };
 
 #endif  // RMW_OPENDDS_CPP__SERVICE_HPP_
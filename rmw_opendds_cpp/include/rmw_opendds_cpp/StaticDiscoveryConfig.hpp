@@ -0,0 +1,92 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__STATICDISCOVERYCONFIG_HPP_
+#define RMW_OPENDDS_CPP__STATICDISCOVERYCONFIG_HPP_
+
+#include <rmw_opendds_cpp/types.hpp>
+
+#include <dds/DdsDcpsInfrastructureC.h>
+
+#include <array>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+class ACE_Configuration_Heap;
+
+// Name of the environment variable holding the path of an OpenDDS configuration file.
+// When it is set, every participant uses OpenDDS static discovery (DEFAULT_STATIC)
+// and endpoints are matched from the [endpoint/*] sections of that file.
+constexpr char static_discovery_env_var[] = "RMW_OPENDDS_STATIC_DISCOVERY_CONFIG";
+
+// StaticDiscoveryConfig maps ROS nodes and endpoints onto the participants and
+// endpoints declared in an OpenDDS static discovery configuration file.
+// Besides the standard OpenDDS sections, the file lists one [rmw_node/<label>]
+// section per node with the keys name, namespace, participant and config.
+class StaticDiscoveryConfig
+{
+public:
+  typedef std::array<CORBA::Octet, 6> ParticipantId;
+  typedef std::array<CORBA::Octet, 3> EntityKey;
+
+  StaticDiscoveryConfig() : enabled_(false) {}
+
+  // Load the file named by static_discovery_env_var, if set, into TheServiceParticipant.
+  // Return true if static discovery is enabled; throw on an invalid configuration.
+  // TheServiceParticipant is configured by the first load only: later ones, e.g. from
+  // another rmw_init, must name the same file.
+  bool load_from_env();
+  bool enabled() const { return enabled_; }
+
+  // Read the rmw sections of a configuration file without configuring OpenDDS;
+  // throw on an invalid configuration.
+  void parse(const std::string & file);
+
+  // Get the participant id and transport config name of a node; throw if not configured.
+  void get_participant(const std::string & name, const std::string & name_space,
+                       ParticipantId & id, std::string & transport_config) const;
+  // Find the node configured for a (possibly remote) participant.
+  bool find_node(const ParticipantId & id, std::string & name, std::string & name_space) const;
+
+  // Reserve an unused endpoint of the participant for a topic; throw if none is left.
+  EntityKey acquire_entity(const ParticipantId & id, const std::string & topic_name, EntityType type);
+  void release_entity(const ParticipantId & id, const EntityKey & key);
+
+private:
+  struct Node
+  {
+    std::string name;
+    std::string name_space;
+    ParticipantId participant;
+    std::string transport_config;
+  };
+  struct Slot
+  {
+    EntityKey key;
+    bool used;
+  };
+  typedef std::tuple<ParticipantId, std::string, EntityType> EndpointKey;
+
+  void parse(ACE_Configuration_Heap & cf, const std::string & file);
+
+  bool enabled_;
+  std::vector<Node> nodes_;
+  std::map<EndpointKey, std::vector<Slot>> endpoints_;
+  mutable std::mutex mutex_;
+};
+
+#endif  // RMW_OPENDDS_CPP__STATICDISCOVERYCONFIG_HPP_
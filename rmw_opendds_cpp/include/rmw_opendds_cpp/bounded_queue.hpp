@@ -0,0 +1,117 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__BOUNDED_QUEUE_HPP_
+#define RMW_OPENDDS_CPP__BOUNDED_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Lock-free bounded queue for any number of producers and consumers (D. Vyukov's
+// array queue): each cell carries a sequence number telling whose turn it is.
+// T must be copy assignable; the capacity is rounded up to a power of two.
+template<typename T>
+class BoundedQueue
+{
+public:
+  explicit BoundedQueue(size_t capacity)
+  : cells_(round_up(capacity))
+  , mask_(cells_.size() - 1)
+  , head_(0)
+  , pad_()
+  , tail_(0)
+  {
+    for (size_t i = 0; i < cells_.size(); ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+  BoundedQueue(const BoundedQueue &) = delete;
+  BoundedQueue & operator=(const BoundedQueue &) = delete;
+
+  // Return false if the queue is full.
+  bool push(const T & value)
+  {
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell & cell = cells_[pos & mask_];
+      const size_t seq = cell.sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.value = value;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Return false if the queue is empty.
+  bool pop(T & value)
+  {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell & cell = cells_[pos & mask_];
+      const size_t seq = cell.sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          value = cell.value;
+          cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // A hint only while producers or consumers run.
+  bool empty() const
+  {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  static size_t round_up(size_t capacity)
+  {
+    size_t n = 2;
+    while (n < capacity) {
+      n *= 2;
+    }
+    return n;
+  }
+
+  std::vector<Cell> cells_;
+  const size_t mask_;
+  // consumers and producers do not share a cache line
+  std::atomic<size_t> head_;
+  char pad_[64 - sizeof(std::atomic<size_t>)];
+  std::atomic<size_t> tail_;
+};
+
+#endif  // RMW_OPENDDS_CPP__BOUNDED_QUEUE_HPP_
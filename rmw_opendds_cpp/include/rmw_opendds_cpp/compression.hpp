@@ -0,0 +1,56 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__COMPRESSION_HPP_
+#define RMW_OPENDDS_CPP__COMPRESSION_HPP_
+
+#include <rmw_opendds_cpp/publisher_options.h>
+
+#include <rcutils/types/uint8_array.h>
+
+#include <rmw/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Compressed and delta encoded endpoints are in a partition of their own, so that they
+// never match endpoints that would not understand their samples.
+std::string encoding_partition(rmw_opendds_compression_t compression, bool delta);
+
+// Whether this build supports the compression; throws std::runtime_error otherwise.
+void check_compression(rmw_opendds_compression_t compression);
+
+// Every sample of a compressed endpoint starts with a format byte, as the messages that
+// compression does not pay for are sent as they are; the payload follows it.
+enum class PayloadFormat : uint8_t { Plain = 0, Zstd = 1 };
+const size_t payload_header_length = 1;
+
+// The format of a sample of a compressed endpoint, or false if it has no known format byte.
+bool payload_format(const uint8_t * data, size_t length, PayloadFormat & format);
+
+// Encode a message for a compressed endpoint into a buffer of the calling thread, valid
+// until its next call: the format byte, then the message compressed at level if it is at
+// least threshold bytes long and compression shrinks it, or as it is.
+const uint8_t * encode_payload(const uint8_t * data, size_t length, size_t threshold, int level,
+  size_t & encoded_length);
+
+// Decompressed size limit of the subscriptions that do not set one.
+const size_t default_max_decompressed_size = 64 * 1024 * 1024;
+
+// Decompress a zstd payload into a buffer allocated with the allocator of cdr_stream;
+// a payload whose frame declares more than max_size bytes is invalid.
+rmw_ret_t decompress(const uint8_t * data, size_t length, size_t max_size, rcutils_uint8_array_t & cdr_stream);
+
+#endif  // RMW_OPENDDS_CPP__COMPRESSION_HPP_
@@ -0,0 +1,85 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__DELTA_HPP_
+#define RMW_OPENDDS_CPP__DELTA_HPP_
+
+#include <dds/DdsDcpsInfrastructureC.h>
+
+#include <rcutils/types/uint8_array.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Delta frames carry either a keyframe, the whole serialized message, or the byte
+// ranges in which a message differs from the previous one of its writer; every sample
+// of a delta encoded endpoint is one:
+//   'D' 'K' 0 0 | sequence | message
+//   'D' 'D' 0 0 | sequence | { offset | length | bytes }...
+// all numbers being 32 bit little endian.
+bool is_delta_frame(const uint8_t * data, size_t length);
+
+// Encodes the messages of a publisher. Not thread safe: the frames must be written in
+// the order they are encoded.
+class DeltaEncoder
+{
+public:
+  explicit DeltaEncoder(size_t keyframe_interval);
+  // The frame is valid until the next call.
+  const std::vector<uint8_t> & encode(const uint8_t * cdr, size_t length);
+  // Make the next frame a keyframe, e.g. when the last one was not written.
+  void reset() { has_previous_ = false; }
+
+private:
+  const size_t keyframe_interval_;
+  size_t since_keyframe_;
+  uint32_t sequence_;
+  bool has_previous_;
+  std::vector<uint8_t> previous_;
+  std::vector<uint8_t> frame_;
+};
+
+// Rebuilds the messages of the writers of a subscription.
+class DeltaDecoder
+{
+public:
+  enum Result
+  {
+    Decoded,
+    Gap,  // the frame the delta is based on was not received
+    Invalid,
+    BadAlloc
+  };
+  // Decode into a buffer allocated with the allocator of cdr_stream.
+  Result decode(DDS::InstanceHandle_t publication, const uint8_t * frame, size_t length,
+                rcutils_uint8_array_t & cdr_stream);
+  // Forget the writers not among the matched publications, with the messages they kept.
+  void retain(const DDS::InstanceHandleSeq & publications);
+  size_t writers();
+
+private:
+  struct Writer
+  {
+    uint32_t sequence;
+    bool valid;
+    std::vector<uint8_t> message;
+  };
+  std::mutex lock_;
+  std::unordered_map<DDS::InstanceHandle_t, Writer> writers_;
+};
+
+#endif  // RMW_OPENDDS_CPP__DELTA_HPP_
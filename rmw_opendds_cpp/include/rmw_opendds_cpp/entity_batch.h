@@ -0,0 +1,44 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__ENTITY_BATCH_H_
+#define RMW_OPENDDS_CPP__ENTITY_BATCH_H_
+
+#include <rmw_opendds_cpp/visibility_control.h>
+
+#include <rmw/types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Start creating the publishers, subscriptions, clients and services of a node in a batch.
+// Endpoints created until rmw_opendds_end_entity_batch() are not enabled: they are not
+// announced, do not match and cannot publish or take yet.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_begin_entity_batch(const rmw_node_t * node);
+
+// Enable and announce all endpoints created in the batch and trigger the graph guard condition once.
+// The batch ends even on failure; the error names the topics of the endpoints that were not enabled.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_end_entity_batch(const rmw_node_t * node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW_OPENDDS_CPP__ENTITY_BATCH_H_
@@ -0,0 +1,109 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__ENTITY_STATS_H_
+#define RMW_OPENDDS_CPP__ENTITY_STATS_H_
+
+#include <rmw_opendds_cpp/visibility_control.h>
+
+#include <rmw/types.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Totals since the publisher was created.
+typedef struct rmw_opendds_publisher_stats_t
+{
+  uint64_t messages;  // messages written
+  uint64_t bytes;  // bytes written, as sent: after compression and delta encoding
+  uint64_t serialize_ns;  // time spent converting ROS messages to CDR
+  uint64_t write_ns;  // time spent in DataWriter::write
+  uint64_t write_failures;
+  uint64_t write_timeouts;  // writes that blocked for the max blocking time on a full history
+  uint64_t skipped;  // volatile messages not written for lack of matched subscriptions
+  uint64_t dropped;  // messages rejected because the async queue was full
+  uint64_t allocation_failures;
+} rmw_opendds_publisher_stats_t;
+
+// Totals since the subscription was created.
+typedef struct rmw_opendds_subscription_stats_t
+{
+  uint64_t messages;  // messages taken
+  uint64_t bytes;  // bytes of the samples taken or forwarded, as received: before decoding
+  uint64_t take_ns;  // time spent in DataReader::take, misses included
+  uint64_t deserialize_ns;  // time spent converting CDR to ROS messages
+  uint64_t take_misses;  // takes that found no data
+  uint64_t filtered;  // samples dropped by the subscription filter
+  uint64_t delta_gaps;  // delta frames dropped while waiting for a keyframe
+  uint64_t allocation_failures;
+} rmw_opendds_subscription_stats_t;
+
+// Distribution of reception time - source timestamp of the samples taken by a
+// subscription, from a log-linear histogram with a relative precision of 1/16.
+// The source timestamp is the clock of the publishing host: across hosts the
+// latencies include their clock offset, and negative ones are counted apart.
+typedef struct rmw_opendds_latency_stats_t
+{
+  uint64_t count;  // samples recorded, negative ones included
+  uint64_t negative;  // samples received before their source timestamp
+  int64_t min_ns;
+  int64_t max_ns;
+  int64_t mean_ns;
+  int64_t p50_ns;
+  int64_t p90_ns;
+  int64_t p99_ns;
+  int64_t p999_ns;
+} rmw_opendds_latency_stats_t;
+
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_get_publisher_stats(
+  const rmw_publisher_t * publisher,
+  rmw_opendds_publisher_stats_t * stats);
+
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_get_subscription_stats(
+  const rmw_subscription_t * subscription,
+  rmw_opendds_subscription_stats_t * stats);
+
+// Start or stop recording the latency histogram of a subscription. Histograms
+// are recorded from creation when RMW_OPENDDS_LATENCY_HISTOGRAMS is set to 1.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_enable_latency_histogram(
+  const rmw_subscription_t * subscription,
+  bool enable);
+
+// Fails with RMW_RET_UNSUPPORTED if the histogram was never enabled.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_get_latency_stats(
+  const rmw_subscription_t * subscription,
+  rmw_opendds_latency_stats_t * stats);
+
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_reset_latency_histogram(const rmw_subscription_t * subscription);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW_OPENDDS_CPP__ENTITY_STATS_H_
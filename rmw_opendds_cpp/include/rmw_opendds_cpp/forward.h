@@ -0,0 +1,62 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__FORWARD_H_
+#define RMW_OPENDDS_CPP__FORWARD_H_
+
+#include <rmw_opendds_cpp/visibility_control.h>
+
+#include <rmw/types.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// How rmw_opendds_forward() forwards the samples of one route.
+typedef struct rmw_opendds_forward_options_t
+{
+  // Samples taken per call; 0 takes all the samples the subscription holds.
+  size_t max_samples;
+  // Write the samples with the source timestamp of their original publisher.
+  bool keep_source_timestamp;
+} rmw_opendds_forward_options_t;
+
+// All samples, with their source timestamp.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_opendds_forward_options_t
+rmw_opendds_get_default_forward_options(void);
+
+// Take the samples a subscription holds and write them with a publisher of the same
+// type, e.g. in another domain, from the buffers loaned by the subscription's reader:
+// they are neither copied by the rmw nor deserialized. The subscription filter applies;
+// the publisher writes synchronously, even in the asynchronous mode. Sets *forwarded to
+// the number of samples written, or skipped as rmw_publish would, and stops at the first
+// failure.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_forward(
+  const rmw_subscription_t * subscription,
+  const rmw_publisher_t * publisher,
+  const rmw_opendds_forward_options_t * options,
+  size_t * forwarded);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW_OPENDDS_CPP__FORWARD_H_
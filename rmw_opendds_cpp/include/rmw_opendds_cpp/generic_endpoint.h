@@ -0,0 +1,53 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__GENERIC_ENDPOINT_H_
+#define RMW_OPENDDS_CPP__GENERIC_ENDPOINT_H_
+
+#include <rmw_opendds_cpp/visibility_control.h>
+
+#include <rmw/types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Create a publisher or a subscription of serialized messages from the name of their
+// type, ROS (pkg/msg/Type) or DDS (pkg::msg::dds_::Type_), without its type support.
+// They publish with rmw_publish_serialized_message, take with rmw_take_serialized_message
+// and are destroyed with rmw_destroy_publisher and rmw_destroy_subscription.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_publisher_t *
+rmw_opendds_create_generic_publisher(
+  const rmw_node_t * node,
+  const char * type_name,
+  const char * topic_name,
+  const rmw_qos_profile_t * qos_profile,
+  const rmw_publisher_options_t * publisher_options);
+
+RMW_OPENDDS_CPP_PUBLIC
+rmw_subscription_t *
+rmw_opendds_create_generic_subscription(
+  const rmw_node_t * node,
+  const char * type_name,
+  const char * topic_name,
+  const rmw_qos_profile_t * qos_profile,
+  const rmw_subscription_options_t * subscription_options);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW_OPENDDS_CPP__GENERIC_ENDPOINT_H_
@@ -18,6 +18,7 @@
 #include "rmw/types.h"
 
 #include "rmw_opendds_cpp/visibility_control.h"
+#include "rmw_opendds_cpp/StaticDiscoveryConfig.hpp"
 
 #include <dds/DdsDcpsDomainC.h>
 
@@ -26,6 +27,7 @@ struct rmw_context_impl_t
   rmw_context_impl_t();
   ~rmw_context_impl_t();
   DDS::DomainParticipantFactory_var dpf_;
+  StaticDiscoveryConfig static_discovery_;
 };
 
 RMW_OPENDDS_CPP_PUBLIC
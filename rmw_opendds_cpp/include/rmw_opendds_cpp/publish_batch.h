@@ -0,0 +1,54 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__PUBLISH_BATCH_H_
+#define RMW_OPENDDS_CPP__PUBLISH_BATCH_H_
+
+#include <rmw_opendds_cpp/visibility_control.h>
+
+#include <rmw/types.h>
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Publish count messages at once: they are all serialized first, then written, and
+// written together by a batch publisher (see rmw_opendds_publisher_options_t) so that
+// the transport can send them in as few datagrams as possible.
+// Stops at the first failure and sets *published to the number of messages
+// published (or queued or skipped, as rmw_publish would).
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_publish_batch(
+  const rmw_publisher_t * publisher,
+  const void * const * ros_messages,
+  size_t count,
+  size_t * published);
+
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_publish_serialized_batch(
+  const rmw_publisher_t * publisher,
+  const rmw_serialized_message_t * serialized_messages,
+  size_t count,
+  size_t * published);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW_OPENDDS_CPP__PUBLISH_BATCH_H_
@@ -0,0 +1,95 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__PUBLISHER_OPTIONS_H_
+#define RMW_OPENDDS_CPP__PUBLISHER_OPTIONS_H_
+
+#include <rmw_opendds_cpp/visibility_control.h>
+
+#include <rmw/types.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// max_blocking_time_ns of a publisher whose writes never block on a full history.
+#define RMW_OPENDDS_NEVER_BLOCK (-1)
+
+// Compression of the serialized messages of a topic; the publishers and subscriptions
+// of a topic only match those with the same compression.
+typedef enum rmw_opendds_compression_t
+{
+  RMW_OPENDDS_COMPRESSION_NONE = 0,
+  // requires rmw_opendds_cpp built with RMW_OPENDDS_CPP_ENABLE_ZSTD
+  RMW_OPENDDS_COMPRESSION_ZSTD
+} rmw_opendds_compression_t;
+
+// Options of rmw_opendds_cpp publishers, passed as the rmw_specific_publisher_payload
+// of rmw_publisher_options_t to rmw_create_publisher; they are copied.
+typedef struct rmw_opendds_publisher_options_t
+{
+  // rmw_publish serializes the message on the caller's thread and queues it, and a
+  // thread of the publisher writes it, so that rmw_publish never blocks on the network.
+  bool async;
+  // Messages the queue holds; publishing to a full queue fails with RMW_RET_ERROR.
+  size_t async_queue_depth;
+  // CPU the writing thread is pinned to, or -1 (Linux only).
+  int async_cpu;
+  // Longest time a write blocks while the history of a reliable publisher is full of
+  // unacknowledged samples, after which rmw_publish fails with RMW_RET_TIMEOUT.
+  // 0 keeps the DDS default (100 ms), so that zeroed options change nothing;
+  // RMW_OPENDDS_NEVER_BLOCK never blocks.
+  int64_t max_blocking_time_ns;
+  rmw_opendds_compression_t compression;
+  // Smaller messages are sent uncompressed, as are those compression does not shrink.
+  size_t compression_threshold;
+  // zstd level, from 1 (fastest) to 19
+  int compression_level;
+  // Send a keyframe, the whole message, every delta_keyframe_interval messages and
+  // otherwise only the bytes that changed since the previous message; 0 disables it.
+  size_t delta_keyframe_interval;
+  // The publisher has a DDS publisher of its own, which rmw_opendds_publish_batch suspends
+  // while it writes so that the messages of a batch are sent together; the other
+  // publishers of the node share one and are never held back.
+  bool batch;
+} rmw_opendds_publisher_options_t;
+
+// Synchronous publishing with the DDS max blocking time; a queue of 64 messages and
+// no pinning once async is set; no compression, or level 3 above 1 KiB once set;
+// no delta encoding; no batch publisher.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_opendds_publisher_options_t
+rmw_opendds_get_default_publisher_options(void);
+
+// Estimate of the number of samples written by a reliable publisher that some matched
+// subscription has not acknowledged yet: OpenDDS only tells whether every sample is
+// acknowledged, so it is the number written since they last were, an upper bound capped
+// by the history depth for KEEP_LAST; 0 for best effort publishers. Producers can lower
+// their rate as it grows, before writes block.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_get_publisher_unacknowledged_estimate(
+  const rmw_publisher_t * publisher,
+  size_t * count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW_OPENDDS_CPP__PUBLISHER_OPTIONS_H_
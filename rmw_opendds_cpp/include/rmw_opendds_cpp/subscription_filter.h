@@ -0,0 +1,60 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__SUBSCRIPTION_FILTER_H_
+#define RMW_OPENDDS_CPP__SUBSCRIPTION_FILTER_H_
+
+#include <rmw_opendds_cpp/visibility_control.h>
+
+#include <rmw/types.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Return true to deliver a sample, given its CDR serialized message (encapsulation included).
+typedef bool (* rmw_opendds_sample_filter_t)(const uint8_t * cdr, size_t length, void * arg);
+
+// Drop the samples the filter rejects in rmw_take and its variants, before they are
+// copied or deserialized; a null filter delivers all samples again. The filter runs on
+// the taking threads. It may be changed while other threads take, but a take already
+// running may still call the previous filter, so its arg must outlive that take.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_set_subscription_filter(
+  const rmw_subscription_t * subscription,
+  rmw_opendds_sample_filter_t filter,
+  void * arg);
+
+// Deliver at most one sample per instance (for keyless ROS topics: per topic) every
+// separation, through the DDS TIME_BASED_FILTER of the reader; zero delivers all samples.
+// OpenDDS drops the excess samples on reception. The separation may not exceed the
+// deadline of the subscription. RMW_RET_UNSUPPORTED for a delta encoded subscription,
+// whose deltas all need the frame before them.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_ret_t
+rmw_opendds_set_subscription_minimum_separation(
+  const rmw_subscription_t * subscription,
+  rmw_time_t separation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW_OPENDDS_CPP__SUBSCRIPTION_FILTER_H_
@@ -0,0 +1,51 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__SUBSCRIPTION_OPTIONS_H_
+#define RMW_OPENDDS_CPP__SUBSCRIPTION_OPTIONS_H_
+
+#include <rmw_opendds_cpp/publisher_options.h>
+#include <rmw_opendds_cpp/visibility_control.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Options of rmw_opendds_cpp subscriptions, passed as the rmw_specific_subscription_payload
+// of rmw_subscription_options_t to rmw_create_subscription; they are copied.
+typedef struct rmw_opendds_subscription_options_t
+{
+  // Compression of the publishers to match; samples are taken decompressed.
+  rmw_opendds_compression_t compression;
+  // Largest message a compressed sample may decompress to, as declared by its zstd frame;
+  // larger ones are rejected before anything is allocated. 0 keeps the default (64 MiB).
+  size_t max_decompressed_size;
+  // Match delta encoding publishers and rebuild their messages.
+  bool delta;
+} rmw_opendds_subscription_options_t;
+
+// No compression nor delta encoding; compressed samples decompress to at most 64 MiB.
+RMW_OPENDDS_CPP_PUBLIC
+rmw_opendds_subscription_options_t
+rmw_opendds_get_default_subscription_options(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW_OPENDDS_CPP__SUBSCRIPTION_OPTIONS_H_
@@ -0,0 +1,159 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// LTTng-UST tracepoint provider; include rmw_opendds_cpp/trace.hpp instead.
+// Handles are the rmw_publisher_t, rmw_subscription_t and message pointers that
+// ros2_tracing records in rcl and rclcpp, so the events can be joined with its traces.
+
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER rmw_opendds_cpp
+
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE "rmw_opendds_cpp/tp_provider.h"
+
+#if !defined(RMW_OPENDDS_CPP__TP_PROVIDER_H_) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define RMW_OPENDDS_CPP__TP_PROVIDER_H_
+
+#include <lttng/tracepoint.h>
+
+#include <stdint.h>
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  publish,
+  TP_ARGS(
+    const void *, rmw_publisher_handle_arg,
+    const void *, message_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, rmw_publisher_handle, rmw_publisher_handle_arg)
+    ctf_integer_hex(const void *, message, message_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  write_entry,
+  TP_ARGS(
+    const void *, rmw_publisher_handle_arg,
+    uint64_t, size_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, rmw_publisher_handle, rmw_publisher_handle_arg)
+    ctf_integer(uint64_t, size, size_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  write_exit,
+  TP_ARGS(
+    const void *, rmw_publisher_handle_arg,
+    int, return_code_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, rmw_publisher_handle, rmw_publisher_handle_arg)
+    ctf_integer(int, return_code, return_code_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  take_entry,
+  TP_ARGS(
+    const void *, rmw_subscription_handle_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, rmw_subscription_handle, rmw_subscription_handle_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  take_exit,
+  TP_ARGS(
+    const void *, rmw_subscription_handle_arg,
+    int, return_code_arg,
+    uint64_t, size_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, rmw_subscription_handle, rmw_subscription_handle_arg)
+    ctf_integer(int, return_code, return_code_arg)
+    ctf_integer(uint64_t, size, size_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  deserialize_entry,
+  TP_ARGS(
+    const void *, rmw_subscription_handle_arg,
+    const void *, message_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, rmw_subscription_handle, rmw_subscription_handle_arg)
+    ctf_integer_hex(const void *, message, message_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  deserialize_exit,
+  TP_ARGS(
+    const void *, rmw_subscription_handle_arg,
+    const void *, message_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, rmw_subscription_handle, rmw_subscription_handle_arg)
+    ctf_integer_hex(const void *, message, message_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  wait_entry,
+  TP_ARGS(
+    const void *, wait_set_arg,
+    int64_t, timeout_ns_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, wait_set, wait_set_arg)
+    ctf_integer(int64_t, timeout_ns, timeout_ns_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  wait_exit,
+  TP_ARGS(
+    const void *, wait_set_arg,
+    uint32_t, active_conditions_arg),
+  TP_FIELDS(
+    ctf_integer_hex(const void *, wait_set, wait_set_arg)
+    ctf_integer(uint32_t, active_conditions, active_conditions_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  add_information,
+  TP_ARGS(
+    const uint8_t *, guid_arg,
+    const char *, topic_name_arg,
+    const char *, type_name_arg,
+    int, entity_type_arg),
+  TP_FIELDS(
+    ctf_array(uint8_t, guid, guid_arg, 16)
+    ctf_string(topic_name, topic_name_arg)
+    ctf_string(type_name, type_name_arg)
+    ctf_integer(int, entity_type, entity_type_arg))
+)
+
+TRACEPOINT_EVENT(
+  TRACEPOINT_PROVIDER,
+  remove_information,
+  TP_ARGS(
+    const uint8_t *, guid_arg,
+    int, entity_type_arg),
+  TP_FIELDS(
+    ctf_array(uint8_t, guid, guid_arg, 16)
+    ctf_integer(int, entity_type, entity_type_arg))
+)
+
+#endif  // RMW_OPENDDS_CPP__TP_PROVIDER_H_
+
+#include <lttng/tracepoint-event.h>
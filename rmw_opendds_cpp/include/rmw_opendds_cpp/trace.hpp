@@ -0,0 +1,29 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__TRACE_HPP_
+#define RMW_OPENDDS_CPP__TRACE_HPP_
+
+// RMW_OPENDDS_TRACE(event, args...) fires an LTTng-UST tracepoint of
+// rmw_opendds_cpp/tp_provider.h when the library is built with
+// -DRMW_OPENDDS_CPP_ENABLE_TRACING=ON; otherwise it compiles to nothing, its arguments
+// being named in an unevaluated operand so that those only traced are not unused.
+#ifdef RMW_OPENDDS_CPP_TRACING
+#include <rmw_opendds_cpp/tp_provider.h>
+#define RMW_OPENDDS_TRACE(event, ...) tracepoint(rmw_opendds_cpp, event, __VA_ARGS__)
+#else
+#define RMW_OPENDDS_TRACE(event, ...) do { (void)sizeof((__VA_ARGS__, 0)); } while (0)
+#endif
+
+#endif  // RMW_OPENDDS_CPP__TRACE_HPP_
@@ -0,0 +1,24 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_OPENDDS_CPP__TYPE_NAME_HPP_
+#define RMW_OPENDDS_CPP__TYPE_NAME_HPP_
+
+#include <string>
+
+// The DDS name (pkg::msg::dds_::Type_) of a type named either so or by its ROS name
+// (pkg/msg/Type, or pkg/Type for a message); throws std::runtime_error otherwise.
+std::string dds_type_name(const std::string & type_name);
+
+#endif  // RMW_OPENDDS_CPP__TYPE_NAME_HPP_
@@ -136,10 +136,12 @@ public:
   virtual void on_data_available(DDS::DataReader * reader);
 };
 
+// The RTPS GUID of the writer: unlike instance handles, unique across processes.
 struct OpenDDSPublisherGID
 {
-  DDS::InstanceHandle_t publication_handle;
+  DDS::GUID_t guid;
 };
+static_assert(sizeof(OpenDDSPublisherGID) <= RMW_GID_STORAGE_SIZE, "insufficient RMW_GID_STORAGE_SIZE");
 
 struct OpenDDSWaitSetInfo
 {
@@ -18,6 +18,7 @@
 #include <rmw_opendds_cpp/DDSGuardCondition.hpp>
 #include <rmw_opendds_cpp/condition_error.hpp>
 #include <rmw_opendds_cpp/identifier.hpp>
+#include <rmw_opendds_cpp/trace.hpp>
 #include <rmw_opendds_cpp/types.hpp>
 
 #include <dds/DdsDcpsInfrastructureC.h>
@@ -55,7 +56,11 @@ wait(
   RMW_CHECK_FOR_NULL_WITH_MSG(wait_set_info->active_conditions, "active_conditions is null", return RMW_RET_ERROR);
   DDS::ConditionSeq & active_conditions = *(wait_set_info->active_conditions);
 
+  RMW_OPENDDS_TRACE(wait_entry, wait_set_info,
+    wait_timeout ? static_cast<int64_t>(wait_timeout->sec * 1000000000ull + wait_timeout->nsec) : -1);
+
   // Cleaner destructor will clean up the wait set (previously done in wait_set destructor)
+  // and trace the exit of wait
   struct Cleaner
   {
     OpenDDSWaitSetInfo & info;
@@ -72,6 +77,7 @@ wait(
       } else {
         RMW_SET_ERROR_MSG("failed to get attached conditions");
       }
+      RMW_OPENDDS_TRACE(wait_exit, &info, info.active_conditions->length());
     }
   } cleaner(*wait_set_info, dds_wait_set);
 
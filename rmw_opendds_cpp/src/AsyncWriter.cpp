@@ -0,0 +1,107 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/AsyncWriter.hpp>
+#include <rmw_opendds_cpp/DDSPublisher.hpp>
+
+#include <rcutils/logging_macros.h>
+
+#include <rmw/error_handling.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+AsyncWriter::AsyncWriter(DDSPublisher & pub, size_t depth, int cpu)
+: pub_(pub)
+, queue_(depth)
+, stop_(false)
+, sleeping_(false)
+, thread_([this]() {run();})
+{
+#ifdef __linux__
+  if (cpu >= 0) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    if (pthread_setaffinity_np(thread_.native_handle(), sizeof(cpus), &cpus) != 0) {
+      RCUTILS_LOG_WARN_NAMED("rmw_opendds_cpp", "failed to pin the writer thread of %s to CPU %d",
+        pub_.topic_name().c_str(), cpu);
+    }
+  }
+#else
+  (void)cpu;
+#endif
+}
+
+AsyncWriter::~AsyncWriter()
+{
+  {
+    const std::lock_guard<std::mutex> guard(lock_);
+    stop_ = true;
+  }
+  cv_.notify_one();
+  thread_.join();
+}
+
+rmw_ret_t AsyncWriter::push(const rmw_publisher_t * publisher, rcutils_uint8_array_t & cdr_stream)
+{
+  if (!queue_.push(Message{publisher, cdr_stream})) {
+    pub_.stats().dropped.add(1);
+    RMW_SET_ERROR_MSG("the asynchronous queue of the publisher is full");
+    return RMW_RET_ERROR;
+  }
+  cdr_stream.buffer = nullptr;
+  cdr_stream.buffer_length = 0;
+  cdr_stream.buffer_capacity = 0;
+  // pairs with the fence of run(): either the writer sees the message or we see it sleeping
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleeping_.load(std::memory_order_relaxed)) {
+    const std::lock_guard<std::mutex> guard(lock_);
+    cv_.notify_one();
+  }
+  return RMW_RET_OK;
+}
+
+void AsyncWriter::run()
+{
+  Message message;
+  for (;;) {
+    if (queue_.pop(message)) {
+      write(message);
+      continue;
+    }
+    if (stop_) {
+      while (queue_.pop(message)) {
+        write(message);
+      }
+      return;
+    }
+    std::unique_lock<std::mutex> lock(lock_);
+    sleeping_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    cv_.wait(lock, [this]() {return stop_ || !queue_.empty();});
+    sleeping_.store(false, std::memory_order_relaxed);
+  }
+}
+
+void AsyncWriter::write(Message & message)
+{
+  if (pub_.write(message.publisher, message.cdr_stream) != RMW_RET_OK) {
+    // counted in the publisher statistics; there is no caller to report to
+    rmw_reset_error();
+  }
+  message.cdr_stream.allocator.deallocate(message.cdr_stream.buffer, message.cdr_stream.allocator.state);
+}
@@ -12,10 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <rmw_opendds_cpp/AsyncWriter.hpp>
 #include <rmw_opendds_cpp/DDSPublisher.hpp>
+#include <rmw_opendds_cpp/OpenDDSNode.hpp>
+#include <rmw_opendds_cpp/compression.hpp>
+#include <rmw_opendds_cpp/delta.hpp>
 #include <rmw_opendds_cpp/event_converter.hpp>
 #include <rmw_opendds_cpp/identifier.hpp>
 #include <rmw_opendds_cpp/qos.hpp>
+#include <rmw_opendds_cpp/trace.hpp>
 #include <rmw_opendds_cpp/types.hpp>
 
 #include <dds/DCPS/DataWriterImpl_T.h>
@@ -24,6 +29,11 @@
 #include <rmw/visibility_control.h>
 #include <rmw/incompatible_qos_events_statuses.h>
 
+#include <algorithm>
+#include <limits>
+
+static const size_t buffer_max = (std::numeric_limits<CORBA::ULong>::max)();
+
 DDSPublisher * DDSPublisher::from(const rmw_publisher_t * pub)
 {
   if (!pub) {
@@ -53,12 +63,24 @@ rmw_ret_t DDSPublisher::get_rmw_qos(rmw_qos_profile_t & qos) const
   return RMW_RET_ERROR;
 }
 
+// The writer GUID is assigned when the writer is enabled, which an entity batch may defer.
+rmw_gid_t DDSPublisher::gid() const
+{
+  rmw_gid_t gid = {opendds_identifier, {0}};
+  reinterpret_cast<OpenDDSPublisherGID*>(gid.data)->guid = node_->guid(writer_->get_instance_handle());
+  return gid;
+}
+
 rmw_ret_t DDSPublisher::to_cdr_stream(const void * ros_message, rcutils_uint8_array_t & cdr_stream)
 {
   if (!ros_message) {
     RMW_SET_ERROR_MSG("ros_message is null");
     return RMW_RET_ERROR;
   }
+  if (!topic_.callbacks()) {
+    RMW_SET_ERROR_MSG("a generic publisher only publishes serialized messages");
+    return RMW_RET_ERROR;
+  }
   if (topic_.callbacks()->to_cdr_stream(ros_message, &cdr_stream)) {
     return RMW_RET_OK;
   }
@@ -66,6 +88,192 @@ rmw_ret_t DDSPublisher::to_cdr_stream(const void * ros_message, rcutils_uint8_ar
   return RMW_RET_ERROR;
 }
 
+namespace {
+
+// A sample whose serialized data borrows a buffer until it is destroyed, even by an
+// exception, so that the sequence never frees the buffer.
+class BorrowedSample
+{
+public:
+  BorrowedSample(const uint8_t * buffer, size_t length)
+  {
+    const CORBA::ULong n = static_cast<CORBA::ULong>(length);
+    sample_.serialized_data.replace(n, n, const_cast<CORBA::Octet *>(buffer), false);
+  }
+  ~BorrowedSample()
+  {
+    sample_.serialized_data.replace(0, 0, nullptr, false);
+  }
+  BorrowedSample(const BorrowedSample &) = delete;
+  BorrowedSample & operator=(const BorrowedSample &) = delete;
+
+  const OpenDDSStaticSerializedData & sample() const { return sample_; }
+
+private:
+  OpenDDSStaticSerializedData sample_;
+};
+
+}  // namespace
+
+rmw_ret_t DDSPublisher::write(const rmw_publisher_t * publisher, const rcutils_uint8_array_t & cdr_stream)
+{
+  if (cdr_stream.buffer_length > buffer_max) {
+    RMW_SET_ERROR_MSG("cdr_stream.buffer_length > buffer_max");
+    return RMW_RET_ERROR;
+  }
+  if (!cdr_stream.buffer && cdr_stream.buffer_length) {
+    RMW_SET_ERROR_MSG("cdr_stream.buffer is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  const uint8_t * buffer = cdr_stream.buffer;
+  size_t buffer_length = cdr_stream.buffer_length;
+  std::unique_lock<std::mutex> delta_guard;
+  if (delta_) {
+    delta_guard = std::unique_lock<std::mutex>(delta_lock_);
+    const std::vector<uint8_t> & frame = delta_->encode(buffer, buffer_length);
+    if (frame.size() > buffer_max) {
+      delta_->reset();
+      RMW_SET_ERROR_MSG("delta frame length > buffer_max");
+      return RMW_RET_ERROR;
+    }
+    buffer = frame.data();
+    buffer_length = frame.size();
+  }
+  if (compression_ != RMW_OPENDDS_COMPRESSION_NONE) {
+    size_t encoded_length = 0;
+    buffer = encode_payload(buffer, buffer_length, compression_threshold_, compression_level_, encoded_length);
+    buffer_length = encoded_length;
+  }
+
+  // The sample borrows the buffer: the writer copies it into the message block it marshals
+  // before write returns, which is all that the transport, a suspended publisher included,
+  // later sends, so that the caller, the writer thread of an async publisher, or the next
+  // message of a batch may reuse or free the buffer right after.
+  BorrowedSample instance(buffer, buffer_length);
+  const rmw_ret_t ret = write(publisher, instance.sample(), nullptr);
+  if (ret != RMW_RET_OK && delta_) {
+    delta_->reset();  // the next delta would have no base
+  }
+  return ret;
+}
+
+rmw_ret_t DDSPublisher::write(const rmw_publisher_t * publisher, const OpenDDSStaticSerializedData & sample,
+  const DDS::Time_t * source_timestamp)
+{
+  OpenDDSStaticSerializedDataDataWriter_var writer = OpenDDSStaticSerializedDataDataWriter::_narrow(writer_);
+  if (!writer) {
+    RMW_SET_ERROR_MSG("failed to narrow data writer");
+    return RMW_RET_ERROR;
+  }
+  const CORBA::ULong length = sample.serialized_data.length();
+  RMW_OPENDDS_TRACE(write_entry, publisher, length);
+  const uint64_t start = stats_now_ns();
+  DDS::ReturnCode_t status = source_timestamp ?
+    writer->write_w_timestamp(sample, DDS::HANDLE_NIL, *source_timestamp) :
+    writer->write(sample, DDS::HANDLE_NIL);
+  stats_.write_ns.add(stats_now_ns() - start);
+  RMW_OPENDDS_TRACE(write_exit, publisher, status);
+  if (status == DDS::RETCODE_TIMEOUT) {
+    stats_.write_timeouts.add(1);
+    RMW_SET_ERROR_MSG("write timed out: the history is full of unacknowledged samples");
+    return RMW_RET_TIMEOUT;
+  }
+  if (status != DDS::RETCODE_OK) {
+    stats_.write_failures.add(1);
+    RMW_SET_ERROR_MSG("DataWriter::write failed");
+    return RMW_RET_ERROR;
+  }
+  stats_.messages.add(1);
+  stats_.bytes.add(length);
+  if (unacknowledged_max_) {
+    unacknowledged_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return RMW_RET_OK;
+}
+
+namespace {
+
+// Suspends the publications of a DDS publisher until it is destroyed, even by an exception.
+class Suspension
+{
+public:
+  Suspension(DDS::Publisher_ptr publisher, bool suspend)
+  : publisher_(suspend && publisher->suspend_publications() == DDS::RETCODE_OK ? publisher : nullptr)
+  {
+  }
+  ~Suspension()
+  {
+    resume();
+  }
+  Suspension(const Suspension &) = delete;
+  Suspension & operator=(const Suspension &) = delete;
+
+  bool resume()
+  {
+    DDS::Publisher_ptr publisher = publisher_;
+    publisher_ = nullptr;
+    return !publisher || publisher->resume_publications() == DDS::RETCODE_OK;
+  }
+
+private:
+  DDS::Publisher_ptr publisher_;
+};
+
+}  // namespace
+
+// While the publications of a DDS publisher are suspended, OpenDDS queues the samples
+// and gives them to the transport together on resume, which packs them into as few
+// datagrams as its max message size allows. Only batch publishers suspend theirs, as
+// the shared publisher of the node would hold back the other publishers.
+rmw_ret_t DDSPublisher::write_batch(const rmw_publisher_t * publisher, const rcutils_uint8_array_t * cdr_streams,
+  std::size_t count, std::size_t & written)
+{
+  written = 0;
+  if (count == 0) {
+    return RMW_RET_OK;
+  }
+  Suspension suspension(publisher_.in(), own_publisher_ && count > 1);
+  rmw_ret_t ret = RMW_RET_OK;
+  for (; written < count; ++written) {
+    ret = write(publisher, cdr_streams[written]);
+    if (ret != RMW_RET_OK) {
+      break;  // error set
+    }
+  }
+  if (!suspension.resume() && ret == RMW_RET_OK) {
+    RMW_SET_ERROR_MSG("resume_publications failed");
+    ret = RMW_RET_ERROR;
+  }
+  return ret;
+}
+
+// OpenDDS does not count the samples its writers wait acknowledgments for, only
+// whether there are any: the writes since the writer was last seen acknowledged
+// are an upper bound, which the history depth also bounds.
+std::size_t DDSPublisher::unacknowledged_estimate()
+{
+  if (!unacknowledged_max_) {
+    return 0;
+  }
+  const std::size_t written = unacknowledged_.load(std::memory_order_relaxed);
+  const DDS::Duration_t now = {0, 0};
+  if (writer_->wait_for_acknowledgments(now) == DDS::RETCODE_OK) {
+    unacknowledged_.fetch_sub(written, std::memory_order_relaxed);
+    return 0;
+  }
+  return (std::min)(unacknowledged_.load(std::memory_order_relaxed), unacknowledged_max_);
+}
+
+rmw_ret_t DDSPublisher::check_enabled() const
+{
+  if (!writer_impl_->is_enabled()) {
+    RMW_SET_ERROR_MSG("the publisher is not enabled until its entity batch ends");
+    return RMW_RET_ERROR;
+  }
+  return RMW_RET_OK;
+}
+
 rmw_ret_t DDSPublisher::get_status(const DDS::StatusMask mask, void * rmw_status)
 {
   switch (mask) {
@@ -114,48 +322,102 @@ rmw_ret_t DDSPublisher::get_status(const DDS::StatusMask mask, void * rmw_status
 
 void DDSPublisher::cleanup()
 {
+  // the queued messages are written before the writer is deleted
+  delete async_;
+  async_ = nullptr;
+  delete delta_;
+  delta_ = nullptr;
+  StatsDump::remove(stats_);
   if (writer_) {
+    // the writer is deleted so that its topic can be released
+    if (publisher_->delete_datawriter(writer_) != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("delete_datawriter failed");
+    }
     writer_ = nullptr;
   }
-  if (publisher_) {
-    publisher_ = nullptr;
+  if (own_publisher_ && publisher_) {
+    node_->delete_publisher(publisher_);
   }
+  publisher_ = nullptr;
   OpenDDSPublisherListener::Raf::destroy(listener_);
+  node_->release_entity_key(user_data_);
+  user_data_.value.length(0);
 }
 
-DDSPublisher::DDSPublisher(DDS::DomainParticipant_var dp
+DDSPublisher::DDSPublisher(OpenDDSNode * node
   , const rosidl_message_type_support_t * ros_ts
+  , const char * type_name
   , const char * topic_name
   , const rmw_qos_profile_t * rmw_qos
-) : topic_(ros_ts, topic_name, rmw_qos, dp)
+  , const rmw_opendds_publisher_options_t * options
+) : node_(node)
+  , topic_(ros_ts, type_name, topic_name, rmw_qos, node)
   , listener_(OpenDDSPublisherListener::Raf::create())
   , publisher_()
+  , own_publisher_(options && options->batch)
   , writer_()
-  , publisher_gid_{opendds_identifier, {0}}
+  , writer_impl_()
+  , user_data_()
+  , stats_()
+  , skippable_(false)
+  , async_()
+  , unacknowledged_(0)
+  , unacknowledged_max_(0)
+  , compression_(options ? options->compression : RMW_OPENDDS_COMPRESSION_NONE)
+  , compression_threshold_(options ? options->compression_threshold : 0)
+  , compression_level_(options ? options->compression_level : 0)
+  , delta_lock_()
+  , delta_()
 {
   try {
     if (!listener_) {
       throw std::runtime_error("OpenDDSPublisherListener failed to contstruct");
     }
-    publisher_ = dp->create_publisher(PUBLISHER_QOS_DEFAULT, listener_, DDS::PUBLICATION_MATCHED_STATUS);
-    if (!publisher_) {
-      throw std::runtime_error("create_publisher failed");
+    check_compression(compression_);
+    if (options && options->delta_keyframe_interval) {
+      delta_ = new DeltaEncoder(options->delta_keyframe_interval);
     }
+    const std::string partition = encoding_partition(compression_, delta_ != nullptr);
+    publisher_ = own_publisher_ ? node_->create_publisher(partition) : node_->publisher(partition);
 
     DDS::DataWriterQos dw_qos;
-    if (!get_datawriter_qos(publisher_.in(), *rmw_qos, dw_qos)) {
-      throw std::runtime_error("get_datawriter_qos failed");
+    {
+      const std::lock_guard<std::mutex> guard(node_->default_qos_lock());
+      if (!get_datawriter_qos(publisher_.in(), *rmw_qos, dw_qos)) {
+        throw std::runtime_error("get_datawriter_qos failed");
+      }
+    }
+    node_->set_entity_key(dw_qos.user_data, topic_.name(), EntityType::Publisher);
+    user_data_ = dw_qos.user_data;
+    skippable_ = dw_qos.durability.kind == DDS::VOLATILE_DURABILITY_QOS &&
+      dw_qos.liveliness.kind != DDS::MANUAL_BY_TOPIC_LIVELINESS_QOS;
+    if (options && options->max_blocking_time_ns == RMW_OPENDDS_NEVER_BLOCK) {
+      dw_qos.reliability.max_blocking_time.sec = 0;
+      dw_qos.reliability.max_blocking_time.nanosec = 0;
+    } else if (options && options->max_blocking_time_ns > 0) {
+      dw_qos.reliability.max_blocking_time.sec = static_cast<CORBA::Long>(options->max_blocking_time_ns / 1000000000);
+      dw_qos.reliability.max_blocking_time.nanosec = static_cast<CORBA::ULong>(options->max_blocking_time_ns % 1000000000);
+    } else if (options && options->max_blocking_time_ns < 0) {
+      throw std::runtime_error("max_blocking_time_ns is negative and not RMW_OPENDDS_NEVER_BLOCK");
     }
-    writer_ = publisher_->create_datawriter(topic_.get(), dw_qos, NULL, OpenDDS::DCPS::NO_STATUS_MASK);
+    if (dw_qos.reliability.kind == DDS::RELIABLE_RELIABILITY_QOS) {
+      unacknowledged_max_ = (std::numeric_limits<std::size_t>::max)();
+      if (dw_qos.history.kind == DDS::KEEP_LAST_HISTORY_QOS) {
+        unacknowledged_max_ = static_cast<std::size_t>(dw_qos.history.depth);
+      }
+    }
+    writer_ = publisher_->create_datawriter(topic_.get(), dw_qos, listener_, DDS::PUBLICATION_MATCHED_STATUS);
     if (!writer_) {
       throw std::runtime_error("create_datawriter failed");
     }
     auto wri = dynamic_cast<OpenDDS::DCPS::DataWriterImpl_T<OpenDDSStaticSerializedData>*>(writer_.in());
     wri->set_marshal_skip_serialize(true);
-
-    static_assert(sizeof(OpenDDSPublisherGID) <= RMW_GID_STORAGE_SIZE, "insufficient RMW_GID_STORAGE_SIZE");
-    auto gid = reinterpret_cast<OpenDDSPublisherGID*>(publisher_gid_.data);
-    gid->publication_handle = writer_->get_instance_handle();
+    writer_impl_ = wri;
+    if (options && options->async) {
+      const size_t depth = options->async_queue_depth ? options->async_queue_depth : 64;
+      async_ = new AsyncWriter(*this, depth, options->async_cpu);
+    }
+    StatsDump::add(topic_.name(), stats_);
   } catch (const std::exception& e) {
     RMW_SET_ERROR_MSG(e.what());
     cleanup();
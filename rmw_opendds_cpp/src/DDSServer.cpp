@@ -52,7 +52,7 @@ void DDSServer::add_to(OpenDDSNode * dds_node)
   if (!name || !type_name) {
     throw std::runtime_error("topicdescription name or type_name is null");
   }
-  dds_node->add_sub(reader_->get_instance_handle(), name.in(), type_name.in());
+  dds_node->add_sub(reader_.in(), name.in(), type_name.in());
 
   DDS::Topic_ptr wt = writer_->get_topic();
   if (!wt) {
@@ -63,14 +63,14 @@ void DDSServer::add_to(OpenDDSNode * dds_node)
   if (!name || !type_name) {
     throw std::runtime_error("writer topic name or type_name is null");
   }
-  dds_node->add_pub(writer_->get_instance_handle(), name.in(), type_name.in());
+  dds_node->add_pub(writer_.in(), name.in(), type_name.in());
 }
 
 bool DDSServer::remove_from(OpenDDSNode * dds_node)
 {
   if (dds_node) {
-    return dds_node->remove_pub(writer_->get_instance_handle())
-        && dds_node->remove_sub(reader_->get_instance_handle());
+    return dds_node->remove_pub(writer_.in())
+        && dds_node->remove_sub(reader_.in());
   }
   return false;
 }
@@ -78,8 +78,8 @@ bool DDSServer::remove_from(OpenDDSNode * dds_node)
 DDSServer::DDSServer(const rosidl_service_type_support_t * ts
   , const char * service_name
   , const rmw_qos_profile_t * rmw_qos
-  , DDS::DomainParticipant_var dp
-) : service_(ts, service_name, rmw_qos, dp)
+  , OpenDDSNode * node
+) : service_(ts, service_name, rmw_qos, node)
   , replier_(nullptr)
 {
   try {
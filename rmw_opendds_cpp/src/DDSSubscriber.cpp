@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <rmw_opendds_cpp/DDSSubscriber.hpp>
+#include <rmw_opendds_cpp/OpenDDSNode.hpp>
+#include <rmw_opendds_cpp/compression.hpp>
+#include <rmw_opendds_cpp/delta.hpp>
 #include <rmw_opendds_cpp/event_converter.hpp>
 #include <rmw_opendds_cpp/identifier.hpp>
 #include <rmw_opendds_cpp/qos.hpp>
@@ -23,6 +26,17 @@
 #include <rmw/visibility_control.h>
 #include <rmw/incompatible_qos_events_statuses.h>
 
+#include <algorithm>
+
+void OpenDDSSubscriberListener::on_subscription_matched(DDS::DataReader * reader,
+  const DDS::SubscriptionMatchedStatus & status)
+{
+  current_count_ = status.current_count;
+  if (subscriber_) {
+    subscriber_->update_publications(reader);
+  }
+}
+
 DDSSubscriber * DDSSubscriber::from(const rmw_subscription_t * sub)
 {
   if (!sub) {
@@ -54,6 +68,10 @@ rmw_ret_t DDSSubscriber::get_rmw_qos(rmw_qos_profile_t & qos) const
 
 rmw_ret_t DDSSubscriber::to_ros_message(const rcutils_uint8_array_t & cdr_stream, void * ros_message)
 {
+  if (!topic_.callbacks()) {
+    RMW_SET_ERROR_MSG("a generic subscription only takes serialized messages");
+    return RMW_RET_ERROR;
+  }
   if (topic_.callbacks()->to_message(&cdr_stream, ros_message)) {
     return RMW_RET_OK;
   }
@@ -109,42 +127,157 @@ rmw_ret_t DDSSubscriber::get_status(const DDS::StatusMask mask, void * rmw_statu
   return RMW_RET_OK;
 }
 
+rmw_ret_t DDSSubscriber::set_minimum_separation(const rmw_time_t & separation)
+{
+  // every delta after a frame the filter drops would be a gap until the next keyframe
+  if (delta_) {
+    RMW_SET_ERROR_MSG("delta encoded subscriptions cannot set a minimum separation");
+    return RMW_RET_UNSUPPORTED;
+  }
+  DDS::DataReaderQos dr_qos;
+  if (reader_->get_qos(dr_qos) != DDS::RETCODE_OK) {
+    RMW_SET_ERROR_MSG("get_qos failed");
+    return RMW_RET_ERROR;
+  }
+  time_to_dds(dr_qos.time_based_filter.minimum_separation, separation);
+  const DDS::ReturnCode_t rc = reader_->set_qos(dr_qos);
+  if (rc == DDS::RETCODE_INCONSISTENT_POLICY) {
+    RMW_SET_ERROR_MSG("minimum separation exceeds the deadline");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (rc != DDS::RETCODE_OK) {
+    RMW_SET_ERROR_MSG("set_qos failed");
+    return RMW_RET_ERROR;
+  }
+  return RMW_RET_OK;
+}
+
+void DDSSubscriber::set_filter(rmw_opendds_sample_filter_t filter, void * arg)
+{
+  if (!filter) {
+    filter_.store(nullptr, std::memory_order_release);
+    return;
+  }
+  const std::lock_guard<std::mutex> guard(filters_lock_);
+  auto it = std::find_if(filters_.begin(), filters_.end(),
+    [filter, arg](const Filter & f) {return f.function == filter && f.arg == arg;});
+  if (it == filters_.end()) {
+    it = filters_.insert(filters_.end(), Filter{filter, arg});
+  }
+  filter_.store(&*it, std::memory_order_release);
+}
+
+DDS::GUID_t DDSSubscriber::publisher_guid(DDS::InstanceHandle_t publication_handle) const
+{
+  const std::shared_ptr<const PublisherGuids> guids = std::atomic_load(&publisher_guids_);
+  auto it = guids->find(publication_handle);
+  // the samples of a writer can be taken before its match is reported
+  return it != guids->end() ? it->second : node_->guid(publication_handle);
+}
+
+void DDSSubscriber::update_publications(DDS::DataReader * reader)
+{
+  DDS::InstanceHandleSeq handles;
+  if (reader->get_matched_publications(handles) != DDS::RETCODE_OK) {
+    return;  // resolved per sample until the next match change
+  }
+  if (delta_) {
+    delta_->retain(handles);
+  }
+  const std::lock_guard<std::mutex> guard(publications_lock_);
+  const std::shared_ptr<const PublisherGuids> current = std::atomic_load(&publisher_guids_);
+  auto next = std::make_shared<PublisherGuids>();
+  for (CORBA::ULong i = 0; i < handles.length(); ++i) {
+    auto it = current->find(handles[i]);
+    const DDS::GUID_t guid = it != current->end() ? it->second : node_->guid(handles[i]);
+    if (guid != OpenDDS::DCPS::GUID_UNKNOWN) {
+      next->emplace(handles[i], guid);
+    }
+  }
+  std::atomic_store(&publisher_guids_, std::shared_ptr<const PublisherGuids>(std::move(next)));
+}
+
+void DDSSubscriber::enable_latency_histogram(bool enable)
+{
+  if (enable && !latency_histogram()) {
+    LatencyHistogram * histogram = new LatencyHistogram();
+    LatencyHistogram * expected = nullptr;
+    if (!latency_.compare_exchange_strong(expected, histogram, std::memory_order_acq_rel)) {
+      delete histogram;
+    }
+  }
+  latency_enabled_ = enable;
+}
+
 void DDSSubscriber::cleanup()
 {
+  StatsDump::remove(stats_);
   if (reader_) {
+    if (read_condition_ && reader_->delete_readcondition(read_condition_) != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("delete_readcondition failed");
+    }
+    // the reader is deleted so that its topic can be released
+    if (subscriber_->delete_datareader(reader_) != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("delete_datareader failed");
+    }
     reader_ = nullptr;
   }
-  if (subscriber_) {
-    subscriber_ = nullptr;
-  }
+  read_condition_ = nullptr;
+  subscriber_ = nullptr;
   OpenDDSSubscriberListener::Raf::destroy(listener_);
+  node_->release_entity_key(user_data_);
+  user_data_.value.length(0);
+  latency_enabled_ = false;
+  delete latency_.exchange(nullptr);
+  delete delta_;
+  delta_ = nullptr;
 }
 
-DDSSubscriber::DDSSubscriber(DDS::DomainParticipant_var dp
+DDSSubscriber::DDSSubscriber(OpenDDSNode * node
   , const rosidl_message_type_support_t * ros_ts
+  , const char * type_name
   , const char * topic_name
   , const rmw_qos_profile_t * rmw_qos
-) : topic_(ros_ts, topic_name, rmw_qos, dp)
+  , const rmw_opendds_subscription_options_t * options
+) : node_(node)
+  , topic_(ros_ts, type_name, topic_name, rmw_qos, node)
   , listener_(OpenDDSSubscriberListener::Raf::create())
   , subscriber_()
   , reader_()
   , read_condition_()
+  , user_data_()
   , ignore_local_publications(false)
+  , stats_()
+  , latency_(nullptr)
+  , latency_enabled_(false)
+  , filters_lock_()
+  , filters_()
+  , filter_(nullptr)
+  , compression_(options ? options->compression : RMW_OPENDDS_COMPRESSION_NONE)
+  , max_decompressed_size_(options && options->max_decompressed_size ?
+      options->max_decompressed_size : default_max_decompressed_size)
+  , delta_(options && options->delta ? new DeltaDecoder : nullptr)
+  , publications_lock_()
+  , publisher_guids_(std::make_shared<PublisherGuids>())
 {
   try {
     if (!listener_) {
       throw std::runtime_error("OpenDDSSubscriberListener failed to contstruct");
     }
-    subscriber_ = dp->create_subscriber(SUBSCRIBER_QOS_DEFAULT, listener_, DDS::SUBSCRIPTION_MATCHED_STATUS);
-    if (!subscriber_) {
-      throw std::runtime_error("create_subscriber failed");
-    }
+    check_compression(compression_);
+    subscriber_ = node_->subscriber(encoding_partition(compression_, delta_ != nullptr));
 
     DDS::DataReaderQos dr_qos;
-    if (!get_datareader_qos(subscriber_.in(), *rmw_qos, dr_qos)) {
-      throw std::runtime_error("get_datareader_qos failed");
+    {
+      const std::lock_guard<std::mutex> guard(node_->default_qos_lock());
+      if (!get_datareader_qos(subscriber_.in(), *rmw_qos, dr_qos)) {
+        throw std::runtime_error("get_datareader_qos failed");
+      }
     }
-    reader_ = subscriber_->create_datareader(topic_.get(), dr_qos, NULL, OpenDDS::DCPS::NO_STATUS_MASK);
+    node_->set_entity_key(dr_qos.user_data, topic_.name(), EntityType::Subscriber);
+    user_data_ = dr_qos.user_data;
+    listener_->set_subscriber(this);
+    reader_ = subscriber_->create_datareader(topic_.get(), dr_qos, listener_, DDS::SUBSCRIPTION_MATCHED_STATUS);
     if (!reader_) {
       throw std::runtime_error("create_datawriter failed");
     }
@@ -155,6 +288,10 @@ DDSSubscriber::DDSSubscriber(DDS::DomainParticipant_var dp
     if (!read_condition_) {
       throw std::runtime_error("create_readcondition failed");
     }
+    StatsDump::add(topic_.name(), stats_);
+    if (latency_histograms_from_env()) {
+      enable_latency_histogram(true);
+    }
   } catch (const std::exception& e) {
     RMW_SET_ERROR_MSG(e.what());
     cleanup();
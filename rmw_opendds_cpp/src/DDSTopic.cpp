@@ -11,14 +11,13 @@
 // limitations under the License.
 
 #include <rmw_opendds_cpp/DDSTopic.hpp>
+#include <rmw_opendds_cpp/OpenDDSNode.hpp>
 #include <rmw_opendds_cpp/namespace_prefix.hpp>
+#include <rmw_opendds_cpp/type_name.hpp>
 
 #include <rosidl_typesupport_opendds_c/identifier.h>
 #include <rosidl_typesupport_opendds_cpp/identifier.hpp>
 
-#include <dds/DdsDcpsInfrastructureC.h>
-#include <dds/DCPS/Marked_Default_Qos.h>
-
 #include <rmw/error_handling.h>
 #include <rmw/ret_types.h>
 #include <rmw/types.h>
@@ -26,19 +25,27 @@
 #include <sstream>
 
 DDSTopic::DDSTopic(const rosidl_message_type_support_t * ts
+  , const char * type_name
   , const char * topic_name
   , const rmw_qos_profile_t * rmw_qos
-  , DDS::DomainParticipant_var dp
-) : cb_(get_callbacks(ts))
+  , OpenDDSNode * node
+) : cb_(ts || !type_name ? get_callbacks(ts) : nullptr)
   , name_(create_topic_name(topic_name, rmw_qos))
-  , type_(create_type_name())
+  , type_(create_type_name(type_name))
+  , node_(node)
 {
-  register_type(dp);
-  find_or_create_topic(dp);
+  if (!node_) {
+    throw std::runtime_error("DDSTopic node is null");
+  }
+  topic_ = node_->acquire_topic(name_, type_);
 }
 
 DDSTopic::~DDSTopic()
 {
+  if (topic_) {
+    topic_ = nullptr;
+    node_->release_topic(name_);
+  }
   cb_ = nullptr;
 }
 
@@ -82,34 +89,11 @@ std::string DDSTopic::create_topic_name(const char * topic_name, const rmw_qos_p
   return std::string(ros_topic_prefix) + topic_name;
 }
 
-std::string DDSTopic::create_type_name() const
+// type_name is either the DDS name (pkg::msg::dds_::Type_) or the ROS name (pkg/msg/Type).
+std::string DDSTopic::create_type_name(const char * type_name) const
 {
   if (cb_) {
     return std::string(cb_->message_namespace) + "::dds_::" + cb_->message_name + "_";
   }
-  throw std::runtime_error("create_type_name failed");
-}
-
-void DDSTopic::register_type(DDS::DomainParticipant_var dp)
-{
-  if (!dp) {
-    throw std::runtime_error("DomainParticipant is null");
-  }
-  OpenDDSStaticSerializedDataTypeSupport_var ts = new OpenDDSStaticSerializedDataTypeSupportImpl();
-  if (ts->register_type(dp, type_.c_str()) != DDS::RETCODE_OK) {
-    throw std::runtime_error("register_type failed");
-  }
-}
-
-void DDSTopic::find_or_create_topic(DDS::DomainParticipant_var dp)
-{
-  if (!dp) {
-    throw std::runtime_error("DomainParticipant is null");
-  }
-  DDS::TopicDescription_var td = dp->lookup_topicdescription(name_.c_str());
-  topic_ = td ? dp->find_topic(name_.c_str(), DDS::Duration_t{0, 0}) :
-    dp->create_topic(name_.c_str(), type_.c_str(), TOPIC_QOS_DEFAULT, NULL, OpenDDS::DCPS::NO_STATUS_MASK);
-  if (!topic_) {
-    throw std::runtime_error(std::string(td ? "find" : "create") + "_topic failed");
-  }
+  return dds_type_name(type_name ? type_name : "");
 }
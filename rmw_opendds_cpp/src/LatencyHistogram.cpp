@@ -0,0 +1,109 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/EntityStats.hpp>
+
+#include <algorithm>
+#include <limits>
+
+LatencyHistogram::LatencyHistogram()
+{
+  reset();
+}
+
+size_t LatencyHistogram::index(uint64_t ns)
+{
+  if (ns < sub_buckets) {
+    return static_cast<size_t>(ns);
+  }
+  unsigned msb = 0;
+  for (unsigned shift = 32; shift > 0; shift /= 2) {
+    if (ns >> (msb + shift)) {
+      msb += shift;
+    }
+  }
+  const size_t sub = static_cast<size_t>(ns >> (msb - sub_bucket_bits)) & (sub_buckets - 1);
+  return (msb - sub_bucket_bits + 1) * sub_buckets + sub;
+}
+
+uint64_t LatencyHistogram::lowest(size_t i)
+{
+  if (i < sub_buckets) {
+    return i;
+  }
+  const unsigned msb = static_cast<unsigned>(i / sub_buckets) + sub_bucket_bits - 1;
+  return static_cast<uint64_t>(sub_buckets + i % sub_buckets) << (msb - sub_bucket_bits);
+}
+
+void LatencyHistogram::record(int64_t ns)
+{
+  count_.fetch_add(1, std::memory_order_relaxed);
+  if (ns < 0) {
+    negative_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  sum_.fetch_add(static_cast<uint64_t>(ns), std::memory_order_relaxed);
+  buckets_[index(static_cast<uint64_t>(ns))].fetch_add(1, std::memory_order_relaxed);
+  int64_t v = min_.load(std::memory_order_relaxed);
+  while (ns < v && !min_.compare_exchange_weak(v, ns, std::memory_order_relaxed)) {}
+  v = max_.load(std::memory_order_relaxed);
+  while (ns > v && !max_.compare_exchange_weak(v, ns, std::memory_order_relaxed)) {}
+}
+
+void LatencyHistogram::reset()
+{
+  count_.store(0, std::memory_order_relaxed);
+  negative_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+  for (auto & b : buckets_) {
+    b.store(0, std::memory_order_relaxed);
+  }
+}
+
+// Midpoint of the bucket holding the q quantile of count non-negative samples.
+int64_t LatencyHistogram::percentile(double q, uint64_t count) const
+{
+  const uint64_t rank = static_cast<uint64_t>(q * (count - 1));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < bucket_count; ++i) {
+    seen += buckets_[i].load(std::memory_order_relaxed);
+    if (seen > rank) {
+      return static_cast<int64_t>((lowest(i) + (i + 1 < bucket_count ? lowest(i + 1) - 1 : lowest(i))) / 2);
+    }
+  }
+  return max_.load(std::memory_order_relaxed);
+}
+
+void LatencyHistogram::get(rmw_opendds_latency_stats_t & stats) const
+{
+  stats.count = count_.load(std::memory_order_relaxed);
+  stats.negative = negative_.load(std::memory_order_relaxed);
+  const uint64_t count = stats.count - std::min(stats.negative, stats.count);
+  if (count == 0) {
+    stats.min_ns = stats.max_ns = stats.mean_ns = 0;
+    stats.p50_ns = stats.p90_ns = stats.p99_ns = stats.p999_ns = 0;
+    return;
+  }
+  stats.min_ns = min_.load(std::memory_order_relaxed);
+  stats.max_ns = max_.load(std::memory_order_relaxed);
+  stats.mean_ns = static_cast<int64_t>(sum_.load(std::memory_order_relaxed) / count);
+  // bucket midpoints are clamped to the observed range
+  const auto clamp = [&stats](int64_t v) {return std::max(stats.min_ns, std::min(stats.max_ns, v));};
+  stats.p50_ns = clamp(percentile(0.5, count));
+  stats.p90_ns = clamp(percentile(0.9, count));
+  stats.p99_ns = clamp(percentile(0.99, count));
+  stats.p999_ns = clamp(percentile(0.999, count));
+}
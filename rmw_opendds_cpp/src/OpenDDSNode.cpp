@@ -14,6 +14,7 @@
 
 #include <rmw_opendds_cpp/OpenDDSNode.hpp>
 #include <rmw_opendds_cpp/demangle.hpp>
+#include <rmw_opendds_cpp/guid_helper.hpp>
 #include <rmw_opendds_cpp/init.hpp>
 #include <rmw_opendds_cpp/types.hpp>
 #include <rmw_opendds_cpp/identifier.hpp>
@@ -31,6 +32,8 @@
 #include <dds/DCPS/security/framework/Properties.h>
 #endif
 
+#include <opendds_static_serialized_dataTypeSupportImpl.h>
+
 #include <rcutils/filesystem.h>
 #include <rcutils/strdup.h>
 
@@ -65,38 +68,295 @@ bool OpenDDSNode::validate_name_namespace(const char * node_name, const char * n
   return true;
 }
 
-void OpenDDSNode::add_pub(const DDS::InstanceHandle_t& pub, const std::string& topic_name, const std::string& type_name)
+void OpenDDSNode::add_pub(DDS::Entity * writer, const std::string& topic_name, const std::string& type_name)
 {
-  DDS::GUID_t part_guid = dpi_->get_repoid(dp_->get_instance_handle());
-  DDS::GUID_t guid = dpi_->get_repoid(pub);
-  pub_listener_->add_information(part_guid, guid, topic_name, type_name, EntityType::Publisher);
-  pub_listener_->trigger_graph_guard_condition();
+  add_entity(writer, topic_name, type_name, EntityType::Publisher);
+}
+
+void OpenDDSNode::add_sub(DDS::Entity * reader, const std::string& topic_name, const std::string& type_name)
+{
+  add_entity(reader, topic_name, type_name, EntityType::Subscriber);
+}
+
+bool OpenDDSNode::remove_pub(DDS::Entity * writer)
+{
+  return remove_entity(writer, EntityType::Publisher);
 }
 
-void OpenDDSNode::add_sub(const DDS::InstanceHandle_t& sub, const std::string& topic_name, const std::string& type_name)
+bool OpenDDSNode::remove_sub(DDS::Entity * reader)
 {
+  return remove_entity(reader, EntityType::Subscriber);
+}
+
+void OpenDDSNode::add_entity(DDS::Entity * entity, const std::string& topic_name, const std::string& type_name, EntityType type)
+{
+  if (!entity) {
+    throw std::runtime_error("add_entity: entity is null");
+  }
+  {
+    const Guard guard(lock_);
+    if (batching_) {
+      pending_.push_back(PendingEntity{DDS::Entity::_duplicate(entity), topic_name, type_name, type});
+      return;
+    }
+  }
+  // no-op unless the entity was created in a batch that has ended since
+  if (entity->enable() != DDS::RETCODE_OK) {
+    throw std::runtime_error("enable failed");
+  }
   DDS::GUID_t part_guid = dpi_->get_repoid(dp_->get_instance_handle());
-  DDS::GUID_t guid = dpi_->get_repoid(sub);
-  sub_listener_->add_information(part_guid, guid, topic_name, type_name, EntityType::Subscriber);
-  sub_listener_->trigger_graph_guard_condition();
+  DDS::GUID_t guid = dpi_->get_repoid(entity->get_instance_handle());
+  CustomDataReaderListener * listener = graph_listener(type);
+  listener->add_information(part_guid, guid, topic_name, type_name, type);
+  listener->trigger_graph_guard_condition();
 }
 
-bool OpenDDSNode::remove_pub(const DDS::InstanceHandle_t& pub)
+bool OpenDDSNode::remove_entity(DDS::Entity * entity, EntityType type)
 {
-  DDS::GUID_t guid = dpi_->get_repoid(pub);
-  if (pub_listener_->remove_information(guid, EntityType::Publisher)) {
-    pub_listener_->trigger_graph_guard_condition();
+  if (!entity) {
+    return false;
+  }
+  {
+    const Guard guard(lock_);
+    for (auto it = pending_.begin(); it != pending_.end(); ++it) {
+      if (it->entity.in() == entity) {
+        pending_.erase(it);
+        return true;
+      }
+    }
+  }
+  DDS::GUID_t guid = dpi_->get_repoid(entity->get_instance_handle());
+  CustomDataReaderListener * listener = graph_listener(type);
+  if (listener->remove_information(guid, type)) {
+    listener->trigger_graph_guard_condition();
   }
   return true;
 }
 
-bool OpenDDSNode::remove_sub(const DDS::InstanceHandle_t& sub)
+void OpenDDSNode::begin_batch()
 {
-  DDS::GUID_t guid = dpi_->get_repoid(sub);
-  if (sub_listener_->remove_information(guid, EntityType::Subscriber)) {
-    sub_listener_->trigger_graph_guard_condition();
+  const Guard guard(lock_);
+  if (batching_) {
+    throw std::runtime_error("entity batch already started");
   }
-  return true;
+  try {
+    set_autoenable(false);
+  } catch (...) {
+    try {
+      set_autoenable(true);
+    } catch (...) {
+      // the entities created outside a batch are enabled explicitly anyway
+    }
+    throw;
+  }
+  batching_ = true;
+}
+
+void OpenDDSNode::end_batch()
+{
+  std::vector<PendingEntity> pending;
+  std::string error;
+  {
+    const Guard guard(lock_);
+    if (!batching_) {
+      throw std::runtime_error("no entity batch started");
+    }
+    // the batch ends and its entities are enabled below even if autoenable cannot be restored
+    pending.swap(pending_);
+    batching_ = false;
+    try {
+      set_autoenable(true);
+    } catch (const std::exception & e) {
+      error = e.what();
+    }
+  }
+  std::string failed;
+  if (!pending.empty()) {
+    const DDS::GUID_t part_guid = dpi_->get_repoid(dp_->get_instance_handle());
+    for (const auto & p : pending) {
+      if (p.entity->enable() != DDS::RETCODE_OK) {
+        failed += (failed.empty() ? "" : ", ") + p.topic_name;
+        continue;
+      }
+      const DDS::GUID_t guid = dpi_->get_repoid(p.entity->get_instance_handle());
+      CustomDataReaderListener * listener = graph_listener(p.type);
+      listener->add_information(part_guid, guid, p.topic_name, p.type_name, p.type);
+    }
+    pub_listener_->trigger_graph_guard_condition();
+  }
+  if (!failed.empty()) {
+    error += (error.empty() ? "" : "; ") + std::string("failed to enable the batch entities of topics ") + failed;
+  }
+  if (!error.empty()) {
+    throw std::runtime_error(error);
+  }
+}
+
+// Set autoenable_created_entities of the shared publishers and subscribers; lock_ must be held.
+void OpenDDSNode::set_autoenable(bool autoenable)
+{
+  for (auto & p : publishers_) {
+    DDS::PublisherQos qos;
+    if (p.second->get_qos(qos) != DDS::RETCODE_OK) {
+      throw std::runtime_error("publisher get_qos failed");
+    }
+    qos.entity_factory.autoenable_created_entities = autoenable;
+    if (p.second->set_qos(qos) != DDS::RETCODE_OK) {
+      throw std::runtime_error("publisher set_qos failed");
+    }
+  }
+  for (auto & s : subscribers_) {
+    DDS::SubscriberQos qos;
+    if (s.second->get_qos(qos) != DDS::RETCODE_OK) {
+      throw std::runtime_error("subscriber get_qos failed");
+    }
+    qos.entity_factory.autoenable_created_entities = autoenable;
+    if (s.second->set_qos(qos) != DDS::RETCODE_OK) {
+      throw std::runtime_error("subscriber set_qos failed");
+    }
+  }
+}
+
+void OpenDDSNode::set_entity_key(DDS::UserDataQosPolicy& user_data, const std::string& topic_name, EntityType type)
+{
+  if (static_discovery().enabled()) {
+    const auto key = static_discovery().acquire_entity(participant_id_, topic_name, type);
+    user_data.value.length(static_cast<CORBA::ULong>(key.size()));
+    std::copy(key.begin(), key.end(), user_data.value.get_buffer());
+  }
+}
+
+void OpenDDSNode::release_entity_key(const DDS::UserDataQosPolicy& user_data)
+{
+  StaticDiscoveryConfig::EntityKey key;
+  if (static_discovery().enabled() && user_data.value.length() == key.size()) {
+    std::copy(user_data.value.get_buffer(), user_data.value.get_buffer() + key.size(), key.begin());
+    static_discovery().release_entity(participant_id_, key);
+  }
+}
+
+DDS::Topic_var OpenDDSNode::acquire_topic(const std::string& topic_name, const std::string& type_name)
+{
+  const Guard guard(lock_);
+  auto it = topics_.find(topic_name);
+  if (it != topics_.end()) {
+    if (it->second.type_name != type_name) {
+      throw std::runtime_error("topic '" + topic_name + "' already has type '" + it->second.type_name + '\'');
+    }
+    ++it->second.refs;
+    return it->second.topic;
+  }
+  if (types_.find(type_name) == types_.end()) {
+    OpenDDSStaticSerializedDataTypeSupport_var ts = new OpenDDSStaticSerializedDataTypeSupportImpl();
+    if (ts->register_type(dp_, type_name.c_str()) != DDS::RETCODE_OK) {
+      throw std::runtime_error("register_type failed");
+    }
+    types_.insert(type_name);
+  }
+  // a topic created outside of the registry (e.g. by a service type support) is found instead
+  DDS::TopicDescription_var td = dp_->lookup_topicdescription(topic_name.c_str());
+  if (td) {
+    CORBA::String_var found_type = td->get_type_name();
+    if (type_name != found_type.in()) {
+      throw std::runtime_error("topic '" + topic_name + "' already has type '" + found_type.in() +
+        "', not '" + type_name + '\'');
+    }
+  }
+  DDS::Topic_var topic = td ? dp_->find_topic(topic_name.c_str(), DDS::Duration_t{0, 0}) :
+    dp_->create_topic(topic_name.c_str(), type_name.c_str(), TOPIC_QOS_DEFAULT, NULL, OpenDDS::DCPS::NO_STATUS_MASK);
+  if (!topic) {
+    throw std::runtime_error(std::string(td ? "find" : "create") + "_topic failed");
+  }
+  topics_[topic_name] = TopicRef{topic, type_name, 1};
+  return topic;
+}
+
+void OpenDDSNode::release_topic(const std::string& topic_name)
+{
+  const Guard guard(lock_);
+  auto it = topics_.find(topic_name);
+  if (it == topics_.end() || --it->second.refs > 0) {
+    return;
+  }
+  if (dp_ && dp_->delete_topic(it->second.topic) != DDS::RETCODE_OK) {
+    RMW_SET_ERROR_MSG("delete_topic failed");
+  }
+  topics_.erase(it);
+}
+
+DDS::Publisher_var OpenDDSNode::publisher(const std::string& partition)
+{
+  const Guard guard(lock_);
+  auto it = publishers_.find(partition);
+  if (it != publishers_.end()) {
+    return it->second;
+  }
+  DDS::Publisher_var pub = new_publisher(partition);
+  publishers_[partition] = pub;
+  return pub;
+}
+
+DDS::Publisher_var OpenDDSNode::create_publisher(const std::string& partition)
+{
+  // not in publishers_: its writer is enabled by end_batch like the others, and set_autoenable
+  // need not reach it as it creates no other entity
+  const Guard guard(lock_);
+  return new_publisher(partition);
+}
+
+void OpenDDSNode::delete_publisher(DDS::Publisher_ptr publisher)
+{
+  if (dp_->delete_publisher(publisher) != DDS::RETCODE_OK) {
+    RMW_SET_ERROR_MSG("delete_publisher failed");
+  }
+}
+
+// Create a DDS publisher of the partition; lock_ must be held.
+DDS::Publisher_var OpenDDSNode::new_publisher(const std::string& partition)
+{
+  DDS::PublisherQos qos;
+  if (dp_->get_default_publisher_qos(qos) != DDS::RETCODE_OK) {
+    throw std::runtime_error("get_default_publisher_qos failed");
+  }
+  if (!partition.empty()) {
+    qos.partition.name.length(1);
+    qos.partition.name[0] = partition.c_str();
+  }
+  qos.entity_factory.autoenable_created_entities = !batching_;
+  DDS::Publisher_var pub = dp_->create_publisher(qos, NULL, OpenDDS::DCPS::NO_STATUS_MASK);
+  if (!pub) {
+    throw std::runtime_error("create_publisher failed");
+  }
+  return pub;
+}
+
+DDS::Subscriber_var OpenDDSNode::subscriber(const std::string& partition)
+{
+  const Guard guard(lock_);
+  auto it = subscribers_.find(partition);
+  if (it != subscribers_.end()) {
+    return it->second;
+  }
+  DDS::SubscriberQos qos;
+  if (dp_->get_default_subscriber_qos(qos) != DDS::RETCODE_OK) {
+    throw std::runtime_error("get_default_subscriber_qos failed");
+  }
+  if (!partition.empty()) {
+    qos.partition.name.length(1);
+    qos.partition.name[0] = partition.c_str();
+  }
+  qos.entity_factory.autoenable_created_entities = !batching_;
+  DDS::Subscriber_var sub = dp_->create_subscriber(qos, NULL, OpenDDS::DCPS::NO_STATUS_MASK);
+  if (!sub) {
+    throw std::runtime_error("create_subscriber failed");
+  }
+  subscribers_[partition] = sub;
+  return sub;
+}
+
+StaticDiscoveryConfig& OpenDDSNode::static_discovery() const
+{
+  return context_.impl->static_discovery_;
 }
 
 rmw_ret_t OpenDDSNode::count_publishers(const char * topic_name, size_t * count)
@@ -192,6 +452,10 @@ rmw_ret_t OpenDDSNode::get_names(rcutils_string_array_t * names, rcutils_string_
         if (enclave_found != map.end()) {
           enclave = std::string(enclave_found->second.begin(), enclave_found->second.end());
         }
+        if (name.empty()) {
+          // static discovery participants carry their participant id instead of key-values
+          find_static_node(pbtd.key, name, ns);
+        }
       }
       if (name.empty()) {
         // ignore discovered participants without a name
@@ -335,6 +599,9 @@ OpenDDSNode::OpenDDSNode(rmw_context_t & context, const char * name, const char
   , sub_listener_(nullptr)
   , dp_()
   , dpi_(nullptr)
+  , participant_id_()
+  , transport_config_()
+  , batching_(false)
 {
   try {
     if (name_.empty()) {
@@ -343,6 +610,9 @@ OpenDDSNode::OpenDDSNode(rmw_context_t & context, const char * name, const char
     if (namespace_.empty()) {
       throw std::runtime_error("node namespace_ is null");
     }
+    if (static_discovery().enabled()) {
+      static_discovery().get_participant(name_, namespace_, participant_id_, transport_config_);
+    }
     set_default_participant_qos();
     gc_ = rmw_create_guard_condition(&context);
     if (!gc_) {
@@ -358,7 +628,9 @@ OpenDDSNode::OpenDDSNode(rmw_context_t & context, const char * name, const char
     }
     OpenDDS::DCPS::Discovery_rch disco = TheServiceParticipant->get_discovery(context.options.domain_id);
     OpenDDS::RTPS::RtpsDiscovery_rch rtps_disco = OpenDDS::DCPS::dynamic_rchandle_cast<OpenDDS::RTPS::RtpsDiscovery>(disco);
-    rtps_disco->use_xtypes(false);
+    if (rtps_disco) {
+      rtps_disco->use_xtypes(false);
+    }
     dp_ = context.impl->dpf_->create_participant(
       static_cast<DDS::DomainId_t>(context.options.domain_id), PARTICIPANT_QOS_DEFAULT, 0, 0);
     if (!dp_) {
@@ -406,6 +678,9 @@ OpenDDSNode::OpenDDSNode(rmw_context_t & context, const char * name, const char
 
 void OpenDDSNode::cleanup()
 {
+  pending_.clear();
+  publishers_.clear();
+  subscribers_.clear();
   if (dp_) {
     if (dp_->delete_contained_entities() != DDS::RETCODE_OK) {
       RMW_SET_ERROR_MSG("dp_->delete_contained_entities failed");
@@ -419,6 +694,8 @@ void OpenDDSNode::cleanup()
     }
     dp_ = nullptr;
   }
+  topics_.clear();
+  types_.clear();
 
   CustomSubscriberListener::Raf::destroy(sub_listener_);
   CustomPublisherListener::Raf::destroy(pub_listener_);
@@ -500,6 +777,15 @@ void OpenDDSNode::set_default_participant_qos()
   if (context_.impl->dpf_->get_default_participant_qos(qos) != DDS::RETCODE_OK) {
     throw std::runtime_error("get_default_participant_qos failed");
   }
+  if (static_discovery().enabled()) {
+    // OpenDDS static discovery identifies the participant by its user_data
+    qos.user_data.value.length(static_cast<CORBA::ULong>(participant_id_.size()));
+    std::copy(participant_id_.begin(), participant_id_.end(), qos.user_data.value.get_buffer());
+    if (context_.impl->dpf_->set_default_participant_qos(qos) != DDS::RETCODE_OK) {
+      throw std::runtime_error("set_default_participant_qos failed");
+    }
+    return;
+  }
   // since participant name is not part of DDS spec, set node name in user_data
   const size_t length = name_.length() + namespace_.length() + strlen("name=;namespace=;") + 1;
   qos.user_data.value.length(static_cast<CORBA::Long>(length));
@@ -516,6 +802,15 @@ void OpenDDSNode::set_default_participant_qos()
 bool OpenDDSNode::configureTransport()
 {
   try {
+    if (static_discovery().enabled()) {
+      // static discovery endpoints are bound to the locators of a configured transport
+      OpenDDS::DCPS::TransportConfig_rch cfg = TheTransportRegistry->get_config(transport_config_);
+      if (cfg.is_nil()) {
+        ACE_ERROR_RETURN((LM_ERROR, ACE_TEXT("(%P|%t) ERROR: no transport config %C\n"), transport_config_.c_str()), false);
+      }
+      TheTransportRegistry->bind_config(cfg, dp_.in());
+      return true;
+    }
     static int i = 0;
     const Guard guard(lock_);
     std::string str_domain_id = std::to_string(context_.options.domain_id) + "_" + std::to_string(++i);
@@ -558,11 +853,21 @@ bool OpenDDSNode::match(DDS::UserDataQosPolicy & user_data_qos, const std::strin
   return false;
 }
 
+bool OpenDDSNode::find_static_node(const DDS::BuiltinTopicKey_t & key, std::string & node_name, std::string & node_namespace) const
+{
+  if (!static_discovery().enabled()) {
+    return false;
+  }
+  DDS::GUID_t guid;
+  DDS_BuiltinTopicKey_to_GUID(&guid, key);
+  StaticDiscoveryConfig::ParticipantId id;
+  std::copy(guid.guidPrefix + 6, guid.guidPrefix + 6 + id.size(), id.begin());
+  return static_discovery().find_node(id, node_name, node_namespace);
+}
+
 rmw_ret_t OpenDDSNode::get_key(DDS::GUID_t & key, const char * node_name, const char * node_namespace) const
 {
-  DDS::DomainParticipantQos qos;
-  auto dds_ret = dp_->get_qos(qos);
-  if (dds_ret == DDS::RETCODE_OK && match(qos.user_data, node_name, node_namespace)) {
+  if (name_ == node_name && namespace_ == node_namespace) {
     key = dpi_->get_repoid(dp_->get_instance_handle());
     return RMW_RET_OK;
   }
@@ -577,7 +882,10 @@ rmw_ret_t OpenDDSNode::get_key(DDS::GUID_t & key, const char * node_name, const
     DDS::ParticipantBuiltinTopicData pbtd;
     auto dds_ret = dp_->get_discovered_participant_data(pbtd, handles[i]);
     if (dds_ret == DDS::RETCODE_OK) {
-      if (match(pbtd.user_data, node_name, node_namespace)) {
+      std::string n;
+      std::string ns;
+      if (match(pbtd.user_data, node_name, node_namespace)
+          || (find_static_node(pbtd.key, n, ns) && n == node_name && ns == node_namespace)) {
         DDS_BuiltinTopicKey_to_GUID(&key, pbtd.key);
         return RMW_RET_OK;
       }
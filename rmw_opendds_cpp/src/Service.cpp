@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <rmw_opendds_cpp/Service.hpp>
+#include <rmw_opendds_cpp/OpenDDSNode.hpp>
 #include <rmw_opendds_cpp/namespace_prefix.hpp>
 #include <rmw_opendds_cpp/qos.hpp>
 
@@ -25,49 +26,81 @@
 
 #include <sstream>
 
+namespace {
+
+DDS::ReturnCode_t get_default_qos(DDS::Publisher * pub, DDS::DataWriterQos & qos)
+{
+  return pub->get_default_datawriter_qos(qos);
+}
+
+DDS::ReturnCode_t set_default_qos(DDS::Publisher * pub, const DDS::DataWriterQos & qos)
+{
+  return pub->set_default_datawriter_qos(qos);
+}
+
+DDS::ReturnCode_t get_default_qos(DDS::Subscriber * sub, DDS::DataReaderQos & qos)
+{
+  return sub->get_default_datareader_qos(qos);
+}
+
+DDS::ReturnCode_t set_default_qos(DDS::Subscriber * sub, const DDS::DataReaderQos & qos)
+{
+  return sub->set_default_datareader_qos(qos);
+}
+
+// Captures the default QoS of the node's shared publisher or subscriber and restores
+// it when the scope ends; nothing is restored if it could not be captured.
+template<typename Entity, typename Qos>
+class DefaultQosGuard
+{
+public:
+  explicit DefaultQosGuard(Entity * entity) : entity_(entity), qos_()
+  {
+    if (get_default_qos(entity_, qos_) != DDS::RETCODE_OK) {
+      throw std::runtime_error("failed to get the default qos of the node");
+    }
+  }
+  ~DefaultQosGuard()
+  {
+    if (set_default_qos(entity_, qos_) != DDS::RETCODE_OK) {
+      RMW_SET_ERROR_MSG("failed to restore the default qos of the node");
+    }
+  }
+  DefaultQosGuard(const DefaultQosGuard &) = delete;
+  DefaultQosGuard & operator=(const DefaultQosGuard &) = delete;
+
+private:
+  Entity * entity_;
+  Qos qos_;
+};
+
+typedef DefaultQosGuard<DDS::Publisher, DDS::DataWriterQos> DefaultWriterQosGuard;
+typedef DefaultQosGuard<DDS::Subscriber, DDS::DataReaderQos> DefaultReaderQosGuard;
+
+}  // namespace
+
 Service::Service(const rosidl_service_type_support_t * ts
   , const char * service_name
   , const rmw_qos_profile_t * rmw_qos
-  , DDS::DomainParticipant_var dp
+  , OpenDDSNode * node
 ) : cb_(get_callbacks(ts))
   , name_(service_name ? service_name : "")
   , request_(create_request_name(rmw_qos)) // rmw_qos null-checked
   , reply_(create_reply_name(rmw_qos))
-  , dp_(dp)
+  , qos_(*rmw_qos)
+  , node_(node)
+  , dp_(node ? node->dp() : nullptr)
 {
   try {
     if (name_.empty()) {
       throw std::runtime_error("Service name_ is empty");
     }
-    if (!dp_) {
+    if (!node_ || !dp_) {
       throw std::runtime_error("Service DomainParticipant is null");
     }
 
-    // create publisher
-    pub_ = dp_->create_publisher(PUBLISHER_QOS_DEFAULT, NULL, OpenDDS::DCPS::NO_STATUS_MASK);
-    if (!pub_) {
-      throw std::runtime_error("create_publisher failed");
-    }
-    DDS::DataWriterQos writer_qos;
-    if (!get_datawriter_qos(pub_, *rmw_qos, writer_qos)) {
-      throw std::runtime_error("get_datawriter_qos failed");
-    }
-    if (pub_->set_default_datawriter_qos(writer_qos) != DDS::RETCODE_OK) {
-      throw std::runtime_error("set_default_datawriter_qos failed");
-    }
-
-    // create subscriber
-    sub_ = dp_->create_subscriber(SUBSCRIBER_QOS_DEFAULT, NULL, OpenDDS::DCPS::NO_STATUS_MASK);
-    if (!sub_) {
-      throw std::runtime_error("create_subscriber failed");
-    }
-    DDS::DataReaderQos reader_qos;
-    if (!get_datareader_qos(sub_, *rmw_qos, reader_qos)) {
-      throw std::runtime_error("get_datareader_qos failed");
-    }
-    if (sub_->set_default_datareader_qos(reader_qos) != DDS::RETCODE_OK) {
-      throw std::runtime_error("set_default_datareader_qos failed");
-    }
+    pub_ = node_->publisher();
+    sub_ = node_->subscriber();
   } catch (const std::exception& e) {
     RMW_SET_ERROR_MSG(e.what());
     cleanup();
@@ -81,6 +114,12 @@ Service::Service(const rosidl_service_type_support_t * ts
 
 void Service::cleanup()
 {
+  if (node_) {
+    node_->release_entity_key(writer_user_data_);
+    node_->release_entity_key(reader_user_data_);
+    writer_user_data_.value.length(0);
+    reader_user_data_.value.length(0);
+  }
   if (sub_) {
     sub_ = nullptr;
   }
@@ -94,14 +133,48 @@ void Service::cleanup()
 
 void * Service::create_requester()
 {
+  const std::lock_guard<std::mutex> guard(node_->default_qos_lock());
+  const DefaultWriterQosGuard writer_qos(pub_.in());
+  const DefaultReaderQosGuard reader_qos(sub_.in());
+  set_default_qos(request_, reply_);
   return cb_->create_requester(dp_, request_.c_str(), reply_.c_str(), pub_, sub_, &rmw_allocate, &rmw_free);
 }
 
 void * Service::create_replier()
 {
+  const std::lock_guard<std::mutex> guard(node_->default_qos_lock());
+  const DefaultWriterQosGuard writer_qos(pub_.in());
+  const DefaultReaderQosGuard reader_qos(sub_.in());
+  set_default_qos(reply_, request_);
   return cb_->create_replier(dp_, request_.c_str(), reply_.c_str(), pub_, sub_, &rmw_allocate, &rmw_free);
 }
 
+// The requester/replier entities are created from the default QoS of the shared pub_ and sub_,
+// so the service QoS (and, with static discovery, the entity keys) goes into those defaults
+// until the entities are created; the callers restore them.
+void Service::set_default_qos(const std::string & writer_topic, const std::string & reader_topic)
+{
+  DDS::DataWriterQos writer_qos;
+  if (!get_datawriter_qos(pub_, qos_, writer_qos)) {
+    throw std::runtime_error("get_datawriter_qos failed");
+  }
+  node_->set_entity_key(writer_qos.user_data, writer_topic, EntityType::Publisher);
+  writer_user_data_ = writer_qos.user_data;
+  if (pub_->set_default_datawriter_qos(writer_qos) != DDS::RETCODE_OK) {
+    throw std::runtime_error("set_default_datawriter_qos failed");
+  }
+
+  DDS::DataReaderQos reader_qos;
+  if (!get_datareader_qos(sub_, qos_, reader_qos)) {
+    throw std::runtime_error("get_datareader_qos failed");
+  }
+  node_->set_entity_key(reader_qos.user_data, reader_topic, EntityType::Subscriber);
+  reader_user_data_ = reader_qos.user_data;
+  if (sub_->set_default_datareader_qos(reader_qos) != DDS::RETCODE_OK) {
+    throw std::runtime_error("set_default_datareader_qos failed");
+  }
+}
+
 const char * Service::destroy_requester(void * requester) const
 {
   return cb_->destroy_requester(requester, &rmw_free);
@@ -0,0 +1,231 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/StaticDiscoveryConfig.hpp>
+
+#include <dds/DCPS/ConfigUtils.h>
+#include <dds/DCPS/Service_Participant.h>
+
+#include <ace/Configuration.h>
+#include <ace/Configuration_Import_Export.h>
+
+#include <rcutils/get_env.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+template<size_t N>
+std::array<CORBA::Octet, N> from_hex(const std::string & hex, const std::string & what)
+{
+  if (hex.size() != 2 * N || hex.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) {
+    throw std::runtime_error(what + " '" + hex + "' is not " + std::to_string(2 * N) + " hex digits");
+  }
+  std::array<CORBA::Octet, N> bytes;
+  for (size_t i = 0; i < N; ++i) {
+    bytes[i] = static_cast<CORBA::Octet>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+  }
+  return bytes;
+}
+
+std::string value_of(const OpenDDS::DCPS::ValueMap & values, const char * key, const std::string & def = "")
+{
+  const auto it = values.find(key);
+  return it == values.end() ? def : std::string(it->second.c_str());
+}
+
+// Fill keys with the subsections of [name]; return false if there is no such section.
+bool subsections(ACE_Configuration_Heap & cf, const char * name, OpenDDS::DCPS::KeyList & keys)
+{
+  ACE_Configuration_Section_Key sect;
+  if (cf.open_section(cf.root_section(), ACE_TEXT_CHAR_TO_TCHAR(name), 0, sect) != 0) {
+    return false;
+  }
+  if (OpenDDS::DCPS::processSections(cf, sect, keys) != 0) {
+    throw std::runtime_error(std::string("failed to process [") + name + "] sections");
+  }
+  return true;
+}
+
+void import(ACE_Configuration_Heap & cf, const std::string & file)
+{
+  if (cf.open() != 0) {
+    throw std::runtime_error("failed to open ACE_Configuration_Heap");
+  }
+  ACE_Ini_ImpExp ini(cf);
+  if (ini.import_config(ACE_TEXT_CHAR_TO_TCHAR(file.c_str())) != 0) {
+    throw std::runtime_error("failed to import static discovery configuration '" + file + "'");
+  }
+}
+
+// Topics, QoS, endpoints and transports are handled by OpenDDS itself, and the service
+// participant is configured once per process.
+void load_configuration(ACE_Configuration_Heap & cf, const std::string & file)
+{
+  static std::mutex mutex;
+  static std::string loaded;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!loaded.empty()) {
+    if (loaded != file) {
+      throw std::runtime_error("static discovery configuration '" + loaded + "' is already loaded, '"
+        + file + "' cannot be");
+    }
+    return;
+  }
+  if (TheServiceParticipant->load_configuration(cf, ACE_TEXT_CHAR_TO_TCHAR(file.c_str())) != 0) {
+    throw std::runtime_error("failed to load static discovery configuration '" + file + "'");
+  }
+  loaded = file;
+}
+
+}  // namespace
+
+bool StaticDiscoveryConfig::load_from_env()
+{
+  const char * file = nullptr;
+  const char * err = rcutils_get_env(static_discovery_env_var, &file);
+  if (err) {
+    throw std::runtime_error(std::string("failed to read ") + static_discovery_env_var + ": " + err);
+  }
+  if (file && strlen(file) > 0) {
+    ACE_Configuration_Heap cf;
+    import(cf, file);
+    parse(cf, file);
+    load_configuration(cf, file);
+    TheServiceParticipant->set_default_discovery(OpenDDS::DCPS::Discovery::DEFAULT_STATIC);
+    enabled_ = true;
+  }
+  return enabled_;
+}
+
+void StaticDiscoveryConfig::parse(const std::string & file)
+{
+  ACE_Configuration_Heap cf;
+  import(cf, file);
+  parse(cf, file);
+}
+
+void StaticDiscoveryConfig::parse(ACE_Configuration_Heap & cf, const std::string & file)
+{
+  OpenDDS::DCPS::KeyList keys;
+  if (!subsections(cf, "rmw_node", keys)) {
+    throw std::runtime_error("no [rmw_node/*] sections in '" + file + "'");
+  }
+  for (const auto & k : keys) {
+    OpenDDS::DCPS::ValueMap values;
+    OpenDDS::DCPS::pullValues(cf, k.second, values);
+    const std::string label(k.first.c_str());
+    Node node;
+    node.name = value_of(values, "name", label);
+    node.name_space = value_of(values, "namespace", "/");
+    node.participant = from_hex<6>(value_of(values, "participant"), "rmw_node/" + label + " participant");
+    node.transport_config = value_of(values, "config");
+    if (node.transport_config.empty()) {
+      throw std::runtime_error("rmw_node/" + label + " has no transport config");
+    }
+    nodes_.push_back(node);
+  }
+
+  // [topic/<label>] name defaults to the label
+  std::map<std::string, std::string> topic_names;
+  keys.clear();
+  if (subsections(cf, "topic", keys)) {
+    for (const auto & k : keys) {
+      OpenDDS::DCPS::ValueMap values;
+      OpenDDS::DCPS::pullValues(cf, k.second, values);
+      const std::string label(k.first.c_str());
+      topic_names[label] = value_of(values, "name", label);
+    }
+  }
+
+  keys.clear();
+  if (subsections(cf, "endpoint", keys)) {
+    for (const auto & k : keys) {
+      OpenDDS::DCPS::ValueMap values;
+      OpenDDS::DCPS::pullValues(cf, k.second, values);
+      const std::string label(k.first.c_str());
+      const auto topic = topic_names.find(value_of(values, "topic"));
+      if (topic == topic_names.end()) {
+        throw std::runtime_error("endpoint/" + label + " refers to an unknown topic");
+      }
+      const std::string type = value_of(values, "type");
+      if (type != "writer" && type != "reader") {
+        throw std::runtime_error("endpoint/" + label + " type must be writer or reader");
+      }
+      const EndpointKey key(from_hex<6>(value_of(values, "participant"), "endpoint/" + label + " participant"),
+        topic->second, type == "writer" ? EntityType::Publisher : EntityType::Subscriber);
+      endpoints_[key].push_back(Slot{from_hex<3>(value_of(values, "entity"), "endpoint/" + label + " entity"), false});
+    }
+  }
+}
+
+void StaticDiscoveryConfig::get_participant(const std::string & name, const std::string & name_space,
+  ParticipantId & id, std::string & transport_config) const
+{
+  for (const auto & node : nodes_) {
+    if (node.name == name && node.name_space == name_space) {
+      id = node.participant;
+      transport_config = node.transport_config;
+      return;
+    }
+  }
+  throw std::runtime_error("node '" + name_space + (name_space == "/" ? "" : "/") + name
+    + "' is not in the static discovery configuration");
+}
+
+bool StaticDiscoveryConfig::find_node(const ParticipantId & id, std::string & name, std::string & name_space) const
+{
+  for (const auto & node : nodes_) {
+    if (node.participant == id) {
+      name = node.name;
+      name_space = node.name_space;
+      return true;
+    }
+  }
+  return false;
+}
+
+StaticDiscoveryConfig::EntityKey StaticDiscoveryConfig::acquire_entity(const ParticipantId & id,
+  const std::string & topic_name, EntityType type)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = endpoints_.find(EndpointKey(id, topic_name, type));
+  if (it != endpoints_.end()) {
+    for (auto & slot : it->second) {
+      if (!slot.used) {
+        slot.used = true;
+        return slot.key;
+      }
+    }
+  }
+  throw std::runtime_error("no unused static discovery " + std::string(type == EntityType::Publisher ? "writer" : "reader")
+    + " endpoint for topic '" + topic_name + "'");
+}
+
+void StaticDiscoveryConfig::release_entity(const ParticipantId & id, const EntityKey & key)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto & ep : endpoints_) {
+    if (std::get<0>(ep.first) == id) {
+      for (auto & slot : ep.second) {
+        if (slot.key == key) {
+          slot.used = false;
+          return;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/compression.hpp>
+
+#include <rmw/error_handling.h>
+
+#ifdef RMW_OPENDDS_CPP_ZSTD
+#include <zstd.h>
+#endif
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+std::string encoding_partition(rmw_opendds_compression_t compression, bool delta)
+{
+  std::string partition = compression == RMW_OPENDDS_COMPRESSION_ZSTD ? "rmw_opendds_zstd" : "";
+  if (delta) {
+    partition += partition.empty() ? "rmw_opendds_delta" : "_delta";
+  }
+  return partition;
+}
+
+void check_compression(rmw_opendds_compression_t compression)
+{
+  switch (compression) {
+    case RMW_OPENDDS_COMPRESSION_NONE:
+      return;
+    case RMW_OPENDDS_COMPRESSION_ZSTD:
+#ifdef RMW_OPENDDS_CPP_ZSTD
+      return;
+#else
+      throw std::runtime_error("rmw_opendds_cpp was built without zstd compression");
+#endif
+  }
+  throw std::runtime_error("unknown compression");
+}
+
+bool payload_format(const uint8_t * data, size_t length, PayloadFormat & format)
+{
+  if (length < payload_header_length || data[0] > static_cast<uint8_t>(PayloadFormat::Zstd)) {
+    return false;
+  }
+  format = static_cast<PayloadFormat>(data[0]);
+  return true;
+}
+
+namespace
+{
+// Compression context and output buffer of a thread, reused by its writes.
+struct Encoder
+{
+#ifdef RMW_OPENDDS_CPP_ZSTD
+  Encoder() : cctx(ZSTD_createCCtx()) {}
+  ~Encoder() { ZSTD_freeCCtx(cctx); }
+  ZSTD_CCtx * cctx;
+#endif
+  std::vector<uint8_t> buffer;
+};
+}  // namespace
+
+const uint8_t * encode_payload(const uint8_t * data, size_t length, size_t threshold, int level,
+  size_t & encoded_length)
+{
+  static thread_local Encoder encoder;
+  std::vector<uint8_t> & buffer = encoder.buffer;
+#ifdef RMW_OPENDDS_CPP_ZSTD
+  if (encoder.cctx && length >= threshold) {
+    buffer.resize(payload_header_length + ZSTD_compressBound(length));
+    const size_t n = ZSTD_compressCCtx(encoder.cctx, buffer.data() + payload_header_length,
+      buffer.size() - payload_header_length, data, length, level);
+    if (!ZSTD_isError(n) && n < length) {
+      buffer[0] = static_cast<uint8_t>(PayloadFormat::Zstd);
+      encoded_length = payload_header_length + n;
+      return buffer.data();
+    }
+  }
+#else
+  (void)threshold;
+  (void)level;
+#endif
+  buffer.resize(payload_header_length + length);
+  buffer[0] = static_cast<uint8_t>(PayloadFormat::Plain);
+  if (length) {
+    std::memcpy(buffer.data() + payload_header_length, data, length);
+  }
+  encoded_length = payload_header_length + length;
+  return buffer.data();
+}
+
+#ifdef RMW_OPENDDS_CPP_ZSTD
+
+rmw_ret_t decompress(const uint8_t * data, size_t length, size_t max_size, rcutils_uint8_array_t & cdr_stream)
+{
+  // the frame is not trusted to size the allocation
+  const unsigned long long size = ZSTD_getFrameContentSize(data, length);
+  if (size == ZSTD_CONTENTSIZE_UNKNOWN || size == ZSTD_CONTENTSIZE_ERROR ||
+    size > (std::numeric_limits<uint32_t>::max)() || size > max_size)
+  {
+    RMW_SET_ERROR_MSG("invalid compressed sample");
+    return RMW_RET_ERROR;
+  }
+  uint8_t * buffer = static_cast<uint8_t *>(cdr_stream.allocator.allocate(size, cdr_stream.allocator.state));
+  if (!buffer) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for uint8 array");
+    return RMW_RET_BAD_ALLOC;
+  }
+  const size_t n = ZSTD_decompress(buffer, size, data, length);
+  if (ZSTD_isError(n) || n != size) {
+    cdr_stream.allocator.deallocate(buffer, cdr_stream.allocator.state);
+    RMW_SET_ERROR_MSG("failed to decompress sample");
+    return RMW_RET_ERROR;
+  }
+  cdr_stream.buffer = buffer;
+  cdr_stream.buffer_length = n;
+  cdr_stream.buffer_capacity = n;
+  return RMW_RET_OK;
+}
+
+#else
+
+rmw_ret_t decompress(const uint8_t *, size_t, size_t, rcutils_uint8_array_t &)
+{
+  RMW_SET_ERROR_MSG("rmw_opendds_cpp was built without zstd compression");
+  return RMW_RET_UNSUPPORTED;
+}
+
+#endif
@@ -0,0 +1,186 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/delta.hpp>
+
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+
+namespace
+{
+const uint8_t frame_marker = 'D';
+const uint8_t keyframe_kind = 'K';
+const uint8_t delta_kind = 'D';
+const size_t header_size = 8;
+const size_t range_header_size = 8;
+// equal bytes fewer than this between two changed ranges are sent with them
+const size_t min_gap = range_header_size * 2;
+
+void put32(std::vector<uint8_t> & v, uint32_t x)
+{
+  v.push_back(static_cast<uint8_t>(x));
+  v.push_back(static_cast<uint8_t>(x >> 8));
+  v.push_back(static_cast<uint8_t>(x >> 16));
+  v.push_back(static_cast<uint8_t>(x >> 24));
+}
+
+uint32_t get32(const uint8_t * p)
+{
+  return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 |
+    static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+}
+
+void put_header(std::vector<uint8_t> & v, uint8_t kind, uint32_t sequence)
+{
+  v.clear();
+  v.push_back(frame_marker);
+  v.push_back(kind);
+  v.push_back(0);
+  v.push_back(0);
+  put32(v, sequence);
+}
+}  // namespace
+
+bool is_delta_frame(const uint8_t * data, size_t length)
+{
+  return length >= header_size && data[0] == frame_marker &&
+         (data[1] == keyframe_kind || data[1] == delta_kind);
+}
+
+DeltaEncoder::DeltaEncoder(size_t keyframe_interval)
+: keyframe_interval_(keyframe_interval ? keyframe_interval : 1)
+, since_keyframe_(0)
+, sequence_(0)
+, has_previous_(false)
+{
+}
+
+const std::vector<uint8_t> & DeltaEncoder::encode(const uint8_t * cdr, size_t length)
+{
+  ++sequence_;
+  bool keyframe = !has_previous_ || previous_.size() != length || ++since_keyframe_ >= keyframe_interval_ ||
+    length > (std::numeric_limits<uint32_t>::max)();
+  if (!keyframe) {
+    put_header(frame_, delta_kind, sequence_);
+    for (size_t i = 0; i < length; ) {
+      if (cdr[i] == previous_[i]) {
+        ++i;
+        continue;
+      }
+      size_t end = i + 1;
+      for (size_t j = end, equal = 0; j < length && equal < min_gap; ++j) {
+        if (cdr[j] == previous_[j]) {
+          ++equal;
+        } else {
+          equal = 0;
+          end = j + 1;
+        }
+      }
+      put32(frame_, static_cast<uint32_t>(i));
+      put32(frame_, static_cast<uint32_t>(end - i));
+      frame_.insert(frame_.end(), cdr + i, cdr + end);
+      // a large delta does not pay for the gap it risks
+      if (frame_.size() > length / 2) {
+        keyframe = true;
+        break;
+      }
+      i = end;
+    }
+  }
+  if (keyframe) {
+    put_header(frame_, keyframe_kind, sequence_);
+    frame_.insert(frame_.end(), cdr, cdr + length);
+    since_keyframe_ = 0;
+  }
+  previous_.assign(cdr, cdr + length);
+  has_previous_ = true;
+  return frame_;
+}
+
+DeltaDecoder::Result DeltaDecoder::decode(DDS::InstanceHandle_t publication, const uint8_t * frame, size_t length,
+  rcutils_uint8_array_t & cdr_stream)
+{
+  if (!is_delta_frame(frame, length)) {
+    return Invalid;
+  }
+  const uint32_t sequence = get32(frame + 4);
+  const uint8_t * p = frame + header_size;
+  const uint8_t * const end = frame + length;
+
+  const std::lock_guard<std::mutex> guard(lock_);
+  Writer & writer = writers_[publication];
+  if (frame[1] == keyframe_kind) {
+    try {
+      writer.message.assign(p, end);
+    } catch (const std::bad_alloc &) {
+      writer.valid = false;
+      return BadAlloc;
+    }
+  } else {
+    if (!writer.valid || sequence != writer.sequence + 1) {
+      writer.valid = false;
+      return Gap;
+    }
+    while (p < end) {
+      if (static_cast<size_t>(end - p) < range_header_size) {
+        writer.valid = false;
+        return Invalid;
+      }
+      const size_t offset = get32(p);
+      const size_t n = get32(p + 4);
+      p += range_header_size;
+      if (n > static_cast<size_t>(end - p) || offset > writer.message.size() || n > writer.message.size() - offset) {
+        writer.valid = false;
+        return Invalid;
+      }
+      std::memcpy(writer.message.data() + offset, p, n);
+      p += n;
+    }
+  }
+  writer.sequence = sequence;
+  writer.valid = true;
+
+  const size_t size = writer.message.size();
+  uint8_t * buffer = static_cast<uint8_t *>(cdr_stream.allocator.allocate(size, cdr_stream.allocator.state));
+  if (!buffer && size) {
+    return BadAlloc;
+  }
+  if (size) {
+    std::memcpy(buffer, writer.message.data(), size);
+  }
+  cdr_stream.buffer = buffer;
+  cdr_stream.buffer_length = size;
+  cdr_stream.buffer_capacity = size;
+  return Decoded;
+}
+
+void DeltaDecoder::retain(const DDS::InstanceHandleSeq & publications)
+{
+  const std::lock_guard<std::mutex> guard(lock_);
+  for (auto it = writers_.begin(); it != writers_.end(); ) {
+    bool matched = false;
+    for (CORBA::ULong i = 0; i < publications.length() && !matched; ++i) {
+      matched = publications[i] == it->first;
+    }
+    it = matched ? std::next(it) : writers_.erase(it);
+  }
+}
+
+size_t DeltaDecoder::writers()
+{
+  const std::lock_guard<std::mutex> guard(lock_);
+  return writers_.size();
+}
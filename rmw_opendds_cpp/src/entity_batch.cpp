@@ -0,0 +1,57 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/entity_batch.h>
+#include <rmw_opendds_cpp/OpenDDSNode.hpp>
+
+#include <rmw/error_handling.h>
+
+extern "C"
+{
+rmw_ret_t
+rmw_opendds_begin_entity_batch(const rmw_node_t * node)
+{
+  auto dds_node = OpenDDSNode::from(node);
+  if (!dds_node) {
+    return RMW_RET_ERROR; // error set
+  }
+  try {
+    dds_node->begin_batch();
+    return RMW_RET_OK;
+  } catch (const std::exception& e) {
+    RMW_SET_ERROR_MSG(e.what());
+  } catch (...) {
+    RMW_SET_ERROR_MSG("rmw_opendds_begin_entity_batch failed");
+  }
+  return RMW_RET_ERROR;
+}
+
+rmw_ret_t
+rmw_opendds_end_entity_batch(const rmw_node_t * node)
+{
+  auto dds_node = OpenDDSNode::from(node);
+  if (!dds_node) {
+    return RMW_RET_ERROR; // error set
+  }
+  try {
+    dds_node->end_batch();
+    return RMW_RET_OK;
+  } catch (const std::exception& e) {
+    RMW_SET_ERROR_MSG(e.what());
+  } catch (...) {
+    RMW_SET_ERROR_MSG("rmw_opendds_end_entity_batch failed");
+  }
+  return RMW_RET_ERROR;
+}
+}  // extern "C"
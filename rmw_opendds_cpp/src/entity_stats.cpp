@@ -0,0 +1,328 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/EntityStats.hpp>
+#include <rmw_opendds_cpp/DDSPublisher.hpp>
+#include <rmw_opendds_cpp/DDSSubscriber.hpp>
+
+#include <rcutils/get_env.h>
+#include <rcutils/logging_macros.h>
+
+#include <rmw/error_handling.h>
+
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+void PublisherStats::get(rmw_opendds_publisher_stats_t & stats) const
+{
+  stats.messages = messages.get();
+  stats.bytes = bytes.get();
+  stats.serialize_ns = serialize_ns.get();
+  stats.write_ns = write_ns.get();
+  stats.write_failures = write_failures.get();
+  stats.write_timeouts = write_timeouts.get();
+  stats.skipped = skipped.get();
+  stats.dropped = dropped.get();
+  stats.allocation_failures = allocation_failures.get();
+}
+
+void SubscriberStats::get(rmw_opendds_subscription_stats_t & stats) const
+{
+  stats.messages = messages.get();
+  stats.bytes = bytes.get();
+  stats.take_ns = take_ns.get();
+  stats.deserialize_ns = deserialize_ns.get();
+  stats.take_misses = take_misses.get();
+  stats.filtered = filtered.get();
+  stats.delta_gaps = delta_gaps.get();
+  stats.allocation_failures = allocation_failures.get();
+}
+
+bool latency_histograms_from_env()
+{
+  static const bool enabled = []() {
+      const char * value = nullptr;
+      return !rcutils_get_env("RMW_OPENDDS_LATENCY_HISTOGRAMS", &value) && value && std::strcmp(value, "1") == 0;
+    }();
+  return enabled;
+}
+
+namespace
+{
+
+const char * const stats_period_env_var = "RMW_OPENDDS_STATS_PERIOD_MS";
+
+// The thread logging the statistics runs while entities are registered, so that it is
+// stopped with the last of them rather than at process exit.
+class StatsRegistry
+{
+public:
+  static StatsRegistry & instance()
+  {
+    static StatsRegistry registry;
+    return registry;
+  }
+
+  bool enabled() const { return period_ms_ > 0; }
+
+  template<typename Stats>
+  void add(const std::string & topic, const Stats & stats)
+  {
+    const std::lock_guard<std::mutex> guard(lock_);
+    entities(&stats)[&stats] = topic;
+    if (!thread_.joinable()) {
+      const unsigned generation = ++generation_;
+      thread_ = std::thread([this, generation]() {run(generation);});
+    }
+  }
+
+  template<typename Stats>
+  void remove(const Stats & stats)
+  {
+    std::thread stopped;
+    {
+      const std::lock_guard<std::mutex> guard(lock_);
+      entities(&stats).erase(&stats);
+      if (publishers_.empty() && subscribers_.empty()) {
+        stopped = stop();
+      }
+    }
+    join(stopped);
+  }
+
+private:
+  struct Snapshot
+  {
+    std::vector<std::pair<std::string, rmw_opendds_publisher_stats_t>> publishers;
+    std::vector<std::pair<std::string, rmw_opendds_subscription_stats_t>> subscribers;
+  };
+
+  StatsRegistry() : period_ms_(0), generation_(0)
+  {
+    const char * period = nullptr;
+    if (!rcutils_get_env(stats_period_env_var, &period) && period) {
+      period_ms_ = std::strtol(period, nullptr, 10);
+    }
+  }
+
+  ~StatsRegistry()
+  {
+    std::thread stopped;
+    {
+      const std::lock_guard<std::mutex> guard(lock_);
+      stopped = stop();
+    }
+    join(stopped);
+  }
+
+  std::map<const PublisherStats *, std::string> & entities(const PublisherStats *) { return publishers_; }
+  std::map<const SubscriberStats *, std::string> & entities(const SubscriberStats *) { return subscribers_; }
+
+  // Tell the running thread to stop and return it to be joined without lock_; lock_ must be held.
+  std::thread stop()
+  {
+    ++generation_;
+    return std::move(thread_);
+  }
+
+  void join(std::thread & thread)
+  {
+    if (thread.joinable()) {
+      cv_.notify_all();
+      thread.join();
+    }
+  }
+
+  // Runs until the generation changes; the statistics are logged without lock_, so that
+  // creating and destroying entities never waits for the logging.
+  void run(unsigned generation)
+  {
+    std::unique_lock<std::mutex> lock(lock_);
+    while (!cv_.wait_for(lock, std::chrono::milliseconds(period_ms_),
+      [this, generation]() {return generation_ != generation;}))
+    {
+      const Snapshot snapshot = take_snapshot();
+      lock.unlock();
+      log(snapshot);
+      lock.lock();
+    }
+  }
+
+  // lock_ must be held
+  Snapshot take_snapshot() const
+  {
+    Snapshot snapshot;
+    snapshot.publishers.reserve(publishers_.size());
+    for (const auto & p : publishers_) {
+      snapshot.publishers.emplace_back(p.second, rmw_opendds_publisher_stats_t());
+      p.first->get(snapshot.publishers.back().second);
+    }
+    snapshot.subscribers.reserve(subscribers_.size());
+    for (const auto & p : subscribers_) {
+      snapshot.subscribers.emplace_back(p.second, rmw_opendds_subscription_stats_t());
+      p.first->get(snapshot.subscribers.back().second);
+    }
+    return snapshot;
+  }
+
+  static void log(const Snapshot & snapshot)
+  {
+    for (const auto & p : snapshot.publishers) {
+      const rmw_opendds_publisher_stats_t & s = p.second;
+      RCUTILS_LOG_INFO_NAMED("rmw_opendds_cpp",
+        "publisher %s: messages=%" PRIu64 " bytes=%" PRIu64 " serialize_ns=%" PRIu64 " write_ns=%" PRIu64
+        " write_failures=%" PRIu64 " write_timeouts=%" PRIu64 " skipped=%" PRIu64 " dropped=%" PRIu64
+        " allocation_failures=%" PRIu64,
+        p.first.c_str(), s.messages, s.bytes, s.serialize_ns, s.write_ns, s.write_failures, s.write_timeouts,
+        s.skipped, s.dropped, s.allocation_failures);
+    }
+    for (const auto & p : snapshot.subscribers) {
+      const rmw_opendds_subscription_stats_t & s = p.second;
+      RCUTILS_LOG_INFO_NAMED("rmw_opendds_cpp",
+        "subscription %s: messages=%" PRIu64 " bytes=%" PRIu64 " take_ns=%" PRIu64 " deserialize_ns=%" PRIu64
+        " take_misses=%" PRIu64 " filtered=%" PRIu64 " delta_gaps=%" PRIu64
+        " allocation_failures=%" PRIu64,
+        p.first.c_str(), s.messages, s.bytes, s.take_ns, s.deserialize_ns, s.take_misses, s.filtered,
+        s.delta_gaps, s.allocation_failures);
+    }
+  }
+
+  long period_ms_;
+  unsigned generation_;
+  std::mutex lock_;
+  std::condition_variable cv_;
+  std::map<const PublisherStats *, std::string> publishers_;
+  std::map<const SubscriberStats *, std::string> subscribers_;
+  std::thread thread_;
+};
+
+}  // namespace
+
+void StatsDump::add(const std::string & topic, const PublisherStats & stats)
+{
+  if (StatsRegistry::instance().enabled()) {
+    StatsRegistry::instance().add(topic, stats);
+  }
+}
+
+void StatsDump::add(const std::string & topic, const SubscriberStats & stats)
+{
+  if (StatsRegistry::instance().enabled()) {
+    StatsRegistry::instance().add(topic, stats);
+  }
+}
+
+void StatsDump::remove(const PublisherStats & stats)
+{
+  if (StatsRegistry::instance().enabled()) {
+    StatsRegistry::instance().remove(stats);
+  }
+}
+
+void StatsDump::remove(const SubscriberStats & stats)
+{
+  if (StatsRegistry::instance().enabled()) {
+    StatsRegistry::instance().remove(stats);
+  }
+}
+
+extern "C"
+{
+rmw_ret_t
+rmw_opendds_get_publisher_stats(
+  const rmw_publisher_t * publisher,
+  rmw_opendds_publisher_stats_t * stats)
+{
+  auto dds_pub = DDSPublisher::from(publisher);
+  if (!dds_pub) {
+    return RMW_RET_ERROR; // error set
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(stats, RMW_RET_INVALID_ARGUMENT);
+  dds_pub->stats().get(*stats);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_opendds_get_subscription_stats(
+  const rmw_subscription_t * subscription,
+  rmw_opendds_subscription_stats_t * stats)
+{
+  auto dds_sub = DDSSubscriber::from(subscription);
+  if (!dds_sub) {
+    return RMW_RET_ERROR; // error set
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(stats, RMW_RET_INVALID_ARGUMENT);
+  dds_sub->stats().get(*stats);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_opendds_enable_latency_histogram(
+  const rmw_subscription_t * subscription,
+  bool enable)
+{
+  auto dds_sub = DDSSubscriber::from(subscription);
+  if (!dds_sub) {
+    return RMW_RET_ERROR; // error set
+  }
+  try {
+    dds_sub->enable_latency_histogram(enable);
+    return RMW_RET_OK;
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to allocate latency histogram");
+  }
+  return RMW_RET_BAD_ALLOC;
+}
+
+rmw_ret_t
+rmw_opendds_get_latency_stats(
+  const rmw_subscription_t * subscription,
+  rmw_opendds_latency_stats_t * stats)
+{
+  auto dds_sub = DDSSubscriber::from(subscription);
+  if (!dds_sub) {
+    return RMW_RET_ERROR; // error set
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(stats, RMW_RET_INVALID_ARGUMENT);
+  const LatencyHistogram * histogram = dds_sub->latency_histogram();
+  if (!histogram) {
+    RMW_SET_ERROR_MSG("latency histogram not enabled");
+    return RMW_RET_UNSUPPORTED;
+  }
+  histogram->get(*stats);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_opendds_reset_latency_histogram(const rmw_subscription_t * subscription)
+{
+  auto dds_sub = DDSSubscriber::from(subscription);
+  if (!dds_sub) {
+    return RMW_RET_ERROR; // error set
+  }
+  LatencyHistogram * histogram = dds_sub->latency_histogram();
+  if (histogram) {
+    histogram->reset();
+  }
+  return RMW_RET_OK;
+}
+}  // extern "C"
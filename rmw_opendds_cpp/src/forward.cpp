@@ -0,0 +1,174 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/forward.h>
+#include <rmw_opendds_cpp/DDSPublisher.hpp>
+#include <rmw_opendds_cpp/DDSSubscriber.hpp>
+#include <rmw_opendds_cpp/compression.hpp>
+#include <rmw_opendds_cpp/trace.hpp>
+
+#include <rcutils/allocator.h>
+
+#include <rmw/error_handling.h>
+
+#include <limits>
+
+// The filter of the subscription is given the CDR stream of a sample, so that a
+// compressed sample is decompressed for it; the sample is still forwarded as received.
+static rmw_ret_t
+filter(const DDSSubscriber & dds_sub, const DDS::OctetSeq & data, bool & accepted)
+{
+  const uint8_t * buffer = data.get_buffer();
+  size_t length = data.length();
+  if (!dds_sub.filtering()) {
+    accepted = true;
+    return RMW_RET_OK;
+  }
+  PayloadFormat format = PayloadFormat::Plain;
+  if (dds_sub.compression() != RMW_OPENDDS_COMPRESSION_NONE) {
+    if (!payload_format(buffer, length, format)) {
+      RMW_SET_ERROR_MSG("sample of unknown format");
+      return RMW_RET_ERROR;
+    }
+    buffer += payload_header_length;
+    length -= payload_header_length;
+  }
+  if (format == PayloadFormat::Plain) {
+    accepted = dds_sub.accepts(buffer, length);
+    return RMW_RET_OK;
+  }
+  rcutils_uint8_array_t cdr_stream = rcutils_get_zero_initialized_uint8_array();
+  cdr_stream.allocator = rcutils_get_default_allocator();
+  const rmw_ret_t ret = decompress(buffer, length, dds_sub.max_decompressed_size(), cdr_stream);  // error set
+  if (ret == RMW_RET_OK) {
+    accepted = dds_sub.accepts(cdr_stream.buffer, cdr_stream.buffer_length);
+  }
+  cdr_stream.allocator.deallocate(cdr_stream.buffer, cdr_stream.allocator.state);
+  return ret;
+}
+
+extern "C"
+{
+rmw_opendds_forward_options_t
+rmw_opendds_get_default_forward_options(void)
+{
+  rmw_opendds_forward_options_t options;
+  options.max_samples = 0;
+  options.keep_source_timestamp = true;
+  return options;
+}
+
+rmw_ret_t
+rmw_opendds_forward(
+  const rmw_subscription_t * subscription,
+  const rmw_publisher_t * publisher,
+  const rmw_opendds_forward_options_t * options,
+  size_t * forwarded)
+{
+  auto dds_sub = DDSSubscriber::from(subscription);
+  if (!dds_sub) {
+    return RMW_RET_ERROR; // error set
+  }
+  auto dds_pub = DDSPublisher::from(publisher);
+  if (!dds_pub) {
+    return RMW_RET_ERROR; // error set
+  }
+  if (!forwarded) {
+    RMW_SET_ERROR_MSG("forwarded is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *forwarded = 0;
+  if (dds_sub->topic_type() != dds_pub->topic_type()) {
+    RMW_SET_ERROR_MSG("the subscription and the publisher have different types");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  // samples are forwarded as they were received, compressed or not
+  if (dds_sub->compression() != dds_pub->compression()) {
+    RMW_SET_ERROR_MSG("the subscription and the publisher have different compressions");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  // the frames of several writers would be interleaved under the sequence of one
+  if (dds_sub->delta() || dds_pub->delta()) {
+    RMW_SET_ERROR_MSG("delta encoded samples cannot be forwarded");
+    return RMW_RET_UNSUPPORTED;
+  }
+  if (dds_pub->check_enabled() != RMW_RET_OK) {
+    return RMW_RET_ERROR;  // error set
+  }
+  const rmw_opendds_forward_options_t opts = options ? *options : rmw_opendds_get_default_forward_options();
+  OpenDDSStaticSerializedDataDataReader_var reader = OpenDDSStaticSerializedDataDataReader::_narrow(dds_sub->get_entity());
+  if (!reader) {
+    RMW_SET_ERROR_MSG("failed to narrow data reader");
+    return RMW_RET_ERROR;
+  }
+  const CORBA::Long max_samples = opts.max_samples == 0 ||
+    opts.max_samples > static_cast<size_t>((std::numeric_limits<CORBA::Long>::max)()) ?
+    DDS::LENGTH_UNLIMITED : static_cast<CORBA::Long>(opts.max_samples);
+
+  // loaned samples: the reader keeps their buffers until return_loan
+  OpenDDSStaticSerializedDataSeq msgs;
+  DDS::SampleInfoSeq infos;
+  SubscriberStats & sub_stats = dds_sub->stats();
+  LatencyHistogram * latency = dds_sub->recording_latency_histogram();
+  const int64_t received_ns = latency ? wall_now_ns() : 0;
+  RMW_OPENDDS_TRACE(take_entry, subscription);
+  const uint64_t start = stats_now_ns();
+  DDS::ReturnCode_t rc =
+    reader->take(msgs, infos, max_samples, DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+  sub_stats.take_ns.add(stats_now_ns() - start);
+  RMW_OPENDDS_TRACE(take_exit, subscription, rc, DDS::RETCODE_OK == rc ? msgs.length() : 0);
+  if (DDS::RETCODE_NO_DATA == rc) {
+    sub_stats.take_misses.add(1);
+    return RMW_RET_OK;
+  }
+  if (DDS::RETCODE_OK != rc) {
+    RMW_SET_ERROR_MSG("take failed");
+    return RMW_RET_ERROR;
+  }
+
+  const bool skip = dds_pub->can_skip_publish();
+  rmw_ret_t ret = RMW_RET_OK;
+  for (CORBA::ULong i = 0; i < msgs.length(); ++i) {
+    if (!infos[i].valid_data) {
+      continue;
+    }
+    if (latency) {
+      latency->record(received_ns - source_timestamp_ns(infos[i]));
+    }
+    const DDS::OctetSeq & data = msgs[i].serialized_data;
+    bool accepted = false;
+    ret = filter(*dds_sub, data, accepted);
+    if (ret != RMW_RET_OK) {
+      break;  // error set
+    }
+    if (!accepted) {
+      sub_stats.filtered.add(1);
+      continue;
+    }
+    sub_stats.messages.add(1);
+    sub_stats.bytes.add(data.length());
+    if (skip) {
+      dds_pub->stats().skipped.add(1);
+    } else {
+      ret = dds_pub->write(publisher, msgs[i], opts.keep_source_timestamp ? &infos[i].source_timestamp : nullptr);
+      if (ret != RMW_RET_OK) {
+        break;  // error set
+      }
+    }
+    ++*forwarded;
+  }
+  reader->return_loan(msgs, infos);
+  return ret;
+}
+}  // extern "C"
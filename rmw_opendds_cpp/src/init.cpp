@@ -20,10 +20,12 @@
 
 #include <dds/DCPS/Service_Participant.h>
 
-rmw_context_impl_t::rmw_context_impl_t() : dpf_(TheParticipantFactory)
+rmw_context_impl_t::rmw_context_impl_t() : dpf_(TheParticipantFactory), static_discovery_()
 {
   if (dpf_) {
-    TheServiceParticipant->set_default_discovery(OpenDDS::DCPS::Discovery::DEFAULT_RTPS);
+    if (!static_discovery_.load_from_env()) {
+      TheServiceParticipant->set_default_discovery(OpenDDS::DCPS::Discovery::DEFAULT_RTPS);
+    }
   } else {
     const char* msg = "failed to get participant factory";
     RMW_SET_ERROR_MSG(msg);
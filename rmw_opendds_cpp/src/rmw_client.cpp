@@ -63,7 +63,7 @@ rmw_create_client(
     }
     client->implementation_identifier = opendds_identifier;
     client->data = nullptr;
-    auto dds_client = DDSClient::Raf::create(type_supports, service_name, rmw_qos, dds_node->dp());
+    auto dds_client = DDSClient::Raf::create(type_supports, service_name, rmw_qos, dds_node);
     if (!dds_client) {
       throw std::runtime_error("DDSClient failed");
     }
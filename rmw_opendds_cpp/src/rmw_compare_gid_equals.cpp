@@ -19,6 +19,8 @@
 #include <rmw/impl/cpp/macros.hpp>
 #include <rmw/rmw.h>
 
+#include <cstring>
+
 extern "C"
 {
 rmw_ret_t
@@ -52,7 +54,7 @@ rmw_compare_gids_equal(const rmw_gid_t * gid1, const rmw_gid_t * gid2, bool * re
     RMW_SET_ERROR_MSG("gid2 is invalid");
     return RMW_RET_INVALID_ARGUMENT;
   }
-  *result = (detail1->publication_handle == detail2->publication_handle);
+  *result = std::memcmp(detail1, detail2, sizeof(OpenDDSPublisherGID)) == 0;
   return RMW_RET_OK;
 }
 }  // extern "C"
@@ -12,9 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <rmw_opendds_cpp/AsyncWriter.hpp>
 #include <rmw_opendds_cpp/DDSPublisher.hpp>
-
-#include <dds/DCPS/DataWriterImpl.h>
+#include <rmw_opendds_cpp/SerializationBuffer.hpp>
+#include <rmw_opendds_cpp/publish_batch.h>
+#include <rmw_opendds_cpp/trace.hpp>
 
 #include <ace/Message_Block.h>
 
@@ -22,29 +24,31 @@
 #include <rmw/rmw.h>
 #include <rmw/types.h>
 
-#include <limits>
-
-static const size_t buffer_max = (std::numeric_limits<CORBA::ULong>::max)();
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <vector>
 
-bool
-publish(DDS::DataWriter * dds_data_writer, const rcutils_uint8_array_t * cdr_stream)
+// The caller keeps its message, so the queue of an async publisher is given a copy.
+static rmw_ret_t
+push_copy(const rmw_publisher_t * publisher, DDSPublisher & dds_pub, AsyncWriter & async,
+  const rcutils_uint8_array_t & cdr_stream)
 {
-  OpenDDSStaticSerializedDataDataWriter_var writer = OpenDDSStaticSerializedDataDataWriter::_narrow(dds_data_writer);
-  if (!writer) {
-    RMW_SET_ERROR_MSG("failed to narrow data writer");
-    return false;
+  rcutils_uint8_array_t copy = rcutils_get_zero_initialized_uint8_array();
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  if (rcutils_uint8_array_init(&copy, cdr_stream.buffer_length, &allocator) != RCUTILS_RET_OK) {
+    rcutils_reset_error();
+    dds_pub.stats().allocation_failures.add(1);
+    RMW_SET_ERROR_MSG("failed to allocate a copy of the serialized message");
+    return RMW_RET_BAD_ALLOC;
   }
-  if (cdr_stream->buffer_length > buffer_max) {
-    RMW_SET_ERROR_MSG("cdr_stream->buffer_length > buffer_max");
-    return false;
+  std::memcpy(copy.buffer, cdr_stream.buffer, cdr_stream.buffer_length);
+  copy.buffer_length = cdr_stream.buffer_length;
+  const rmw_ret_t ret = async.push(publisher, copy);  // error set
+  if (ret != RMW_RET_OK) {
+    rcutils_uint8_array_fini(&copy);
   }
-
-  OpenDDSStaticSerializedData instance;
-  instance.serialized_data.length(static_cast<CORBA::ULong>(cdr_stream->buffer_length));
-  std::memcpy(instance.serialized_data.get_buffer(), cdr_stream->buffer, cdr_stream->buffer_length);
-
-  DDS::ReturnCode_t status = writer->write(instance, DDS::HANDLE_NIL);
-  return status == DDS::RETCODE_OK;
+  return ret;
 }
 
 extern "C"
@@ -60,31 +64,61 @@ rmw_publish(
   if (!dds_pub) {
     return RMW_RET_ERROR; // error set
   }
+  RMW_OPENDDS_TRACE(publish, publisher, ros_message);
+  if (dds_pub->check_enabled() != RMW_RET_OK) {
+    return RMW_RET_ERROR;  // error set
+  }
+  if (dds_pub->can_skip_publish()) {
+    dds_pub->stats().skipped.add(1);
+    return RMW_RET_OK;
+  }
 
+  static thread_local SerializationBuffer thread_buffer;
+  AsyncWriter * async = dds_pub->async_writer();
   auto ret = RMW_RET_ERROR;
-  rcutils_uint8_array_t cdr_stream = rcutils_get_zero_initialized_uint8_array();
-  cdr_stream.allocator = rcutils_get_default_allocator();
+  rcutils_uint8_array_t owned = rcutils_get_zero_initialized_uint8_array();
+  owned.allocator = rcutils_get_default_allocator();
+  // the buffer of an async publish is handed over to its writer thread
+  rcutils_uint8_array_t & cdr_stream = async ? owned : thread_buffer.get();
   try {
-    ret = dds_pub->to_cdr_stream(ros_message, cdr_stream);
-    if (ret != RMW_RET_OK) {
-      return ret; //error set
-    }
-    if (cdr_stream.buffer_length == 0) {
-      throw std::runtime_error("no message length set");
-    }
-    if (!cdr_stream.buffer) {
-      throw std::runtime_error("no serialized message attached");
+    const uint8_t * const reused = cdr_stream.buffer;
+    const size_t capacity = cdr_stream.buffer_capacity;
+    const uint64_t start = stats_now_ns();
+    ret = dds_pub->to_cdr_stream(ros_message, cdr_stream);  // error set
+    dds_pub->stats().serialize_ns.add(stats_now_ns() - start);
+    // a message that fits is serialized in place, without reallocating the buffer
+    assert(!reused || cdr_stream.buffer == reused || cdr_stream.buffer_length > capacity);
+    (void)reused;
+    (void)capacity;
+    if (ret == RMW_RET_OK) {
+      if (cdr_stream.buffer_length == 0) {
+        throw std::runtime_error("no message length set");
+      }
+      if (!cdr_stream.buffer) {
+        throw std::runtime_error("no serialized message attached");
+      }
+      if (async) {
+        // on success the writer thread owns and deallocates the buffer
+        ret = async->push(publisher, cdr_stream);  // error set
+      } else {
+        ret = dds_pub->write(publisher, cdr_stream);  // error set
+      }
     }
-    if (!publish(dds_pub->writer(), &cdr_stream)) {
-      throw std::runtime_error("failed to publish message");
-    }
-    ret = RMW_RET_OK;
+  } catch (const std::bad_alloc &) {
+    dds_pub->stats().allocation_failures.add(1);
+    RMW_SET_ERROR_MSG("rmw_publish failed to allocate memory");
+    ret = RMW_RET_BAD_ALLOC;
   } catch (const std::exception& e) {
     RMW_SET_ERROR_MSG(e.what());
+    ret = RMW_RET_ERROR;
   } catch (...) {
     RMW_SET_ERROR_MSG("rmw_publish failed");
+    ret = RMW_RET_ERROR;
+  }
+  owned.allocator.deallocate(owned.buffer, owned.allocator.state);
+  if (!async) {
+    thread_buffer.release();
   }
-  cdr_stream.allocator.deallocate(cdr_stream.buffer, cdr_stream.allocator.state);
   return ret;
 }
 
@@ -103,11 +137,123 @@ rmw_publish_serialized_message(
     RMW_SET_ERROR_MSG("serialized message is null");
     return RMW_RET_ERROR;
   }
-  if (!publish(dds_pub->writer(), serialized_message)) {
-    RMW_SET_ERROR_MSG("failed to publish message");
-    return RMW_RET_ERROR;
+  if (dds_pub->check_enabled() != RMW_RET_OK) {
+    return RMW_RET_ERROR;  // error set
+  }
+  if (dds_pub->can_skip_publish()) {
+    dds_pub->stats().skipped.add(1);
+    return RMW_RET_OK;
+  }
+  if (AsyncWriter * async = dds_pub->async_writer()) {
+    return push_copy(publisher, *dds_pub, *async, *serialized_message);
+  }
+  // written from the caller's buffer, which it keeps
+  return dds_pub->write(publisher, *serialized_message);  // error set
+}
+
+rmw_ret_t
+rmw_opendds_publish_batch(
+  const rmw_publisher_t * publisher,
+  const void * const * ros_messages,
+  size_t count,
+  size_t * published)
+{
+  auto dds_pub = DDSPublisher::from(publisher);
+  if (!dds_pub) {
+    return RMW_RET_ERROR; // error set
+  }
+  if (!published || (count && !ros_messages)) {
+    RMW_SET_ERROR_MSG("ros_messages or published is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *published = 0;
+  if (dds_pub->check_enabled() != RMW_RET_OK) {
+    return RMW_RET_ERROR;  // error set
+  }
+  if (dds_pub->can_skip_publish()) {
+    dds_pub->stats().skipped.add(count);
+    *published = count;
+    return RMW_RET_OK;
+  }
+
+  auto ret = RMW_RET_OK;
+  std::vector<rcutils_uint8_array_t> cdr_streams;
+  try {
+    cdr_streams.reserve(count);
+    const uint64_t start = stats_now_ns();
+    for (size_t i = 0; i < count && ret == RMW_RET_OK; ++i) {
+      RMW_OPENDDS_TRACE(publish, publisher, ros_messages[i]);
+      cdr_streams.push_back(rcutils_get_zero_initialized_uint8_array());
+      cdr_streams.back().allocator = rcutils_get_default_allocator();
+      ret = dds_pub->to_cdr_stream(ros_messages[i], cdr_streams.back());  // error set
+    }
+    dds_pub->stats().serialize_ns.add(stats_now_ns() - start);
+    if (ret != RMW_RET_OK) {
+      // publish the messages before the one that failed
+      auto & failed = cdr_streams.back();
+      failed.allocator.deallocate(failed.buffer, failed.allocator.state);
+      cdr_streams.pop_back();
+    }
+    rmw_ret_t write_ret = RMW_RET_OK;
+    if (AsyncWriter * async = dds_pub->async_writer()) {
+      for (auto & cdr_stream : cdr_streams) {
+        write_ret = async->push(publisher, cdr_stream);  // error set
+        if (write_ret != RMW_RET_OK) {
+          break;
+        }
+        ++*published;
+      }
+    } else {
+      write_ret = dds_pub->write_batch(publisher, cdr_streams.data(), cdr_streams.size(), *published);
+    }
+    if (ret == RMW_RET_OK) {
+      ret = write_ret;
+    }
+  } catch (const std::bad_alloc &) {
+    dds_pub->stats().allocation_failures.add(1);
+    RMW_SET_ERROR_MSG("rmw_opendds_publish_batch failed to allocate memory");
+    ret = RMW_RET_BAD_ALLOC;
+  }
+  for (auto & cdr_stream : cdr_streams) {
+    cdr_stream.allocator.deallocate(cdr_stream.buffer, cdr_stream.allocator.state);
+  }
+  return ret;
+}
+
+rmw_ret_t
+rmw_opendds_publish_serialized_batch(
+  const rmw_publisher_t * publisher,
+  const rmw_serialized_message_t * serialized_messages,
+  size_t count,
+  size_t * published)
+{
+  auto dds_pub = DDSPublisher::from(publisher);
+  if (!dds_pub) {
+    return RMW_RET_ERROR; // error set
+  }
+  if (!published || (count && !serialized_messages)) {
+    RMW_SET_ERROR_MSG("serialized_messages or published is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *published = 0;
+  if (dds_pub->check_enabled() != RMW_RET_OK) {
+    return RMW_RET_ERROR;  // error set
+  }
+  if (dds_pub->can_skip_publish()) {
+    dds_pub->stats().skipped.add(count);
+    *published = count;
+    return RMW_RET_OK;
+  }
+  if (AsyncWriter * async = dds_pub->async_writer()) {
+    for (; *published < count; ++*published) {
+      rmw_ret_t ret = push_copy(publisher, *dds_pub, *async, serialized_messages[*published]);
+      if (ret != RMW_RET_OK) {
+        return ret;  // error set
+      }
+    }
+    return RMW_RET_OK;
   }
-  return RMW_RET_OK;
+  return dds_pub->write_batch(publisher, serialized_messages, count, *published);
 }
 
 rmw_ret_t
@@ -14,6 +14,7 @@
 
 #include <rmw_opendds_cpp/DDSPublisher.hpp>
 #include <rmw_opendds_cpp/OpenDDSNode.hpp>
+#include <rmw_opendds_cpp/generic_endpoint.h>
 #include <rmw_opendds_cpp/identifier.hpp>
 #include <rmw_opendds_cpp/qos.hpp>
 #include <rmw_opendds_cpp/types.hpp>
@@ -35,6 +36,39 @@
 
 extern "C"
 {
+rmw_opendds_publisher_options_t
+rmw_opendds_get_default_publisher_options(void)
+{
+  rmw_opendds_publisher_options_t options;
+  options.async = false;
+  options.async_queue_depth = 64;
+  options.async_cpu = -1;
+  options.max_blocking_time_ns = 0;
+  options.compression = RMW_OPENDDS_COMPRESSION_NONE;
+  options.compression_threshold = 1024;
+  options.compression_level = 3;
+  options.delta_keyframe_interval = 0;
+  options.batch = false;
+  return options;
+}
+
+rmw_ret_t
+rmw_opendds_get_publisher_unacknowledged_estimate(
+  const rmw_publisher_t * publisher,
+  size_t * count)
+{
+  auto dds_pub = DDSPublisher::from(publisher);
+  if (!dds_pub) {
+    return RMW_RET_ERROR; // error set
+  }
+  if (!count) {
+    RMW_SET_ERROR_MSG("count is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *count = dds_pub->unacknowledged_estimate();
+  return RMW_RET_OK;
+}
+
 rmw_ret_t
 rmw_init_publisher_allocation(
   const rosidl_message_type_support_t * type_support,
@@ -88,10 +122,12 @@ rmw_publisher_t * create_initial_publisher(const rmw_publisher_options_t * publi
   return publisher;
 }
 
-rmw_publisher_t *
-rmw_create_publisher(
+// type_supports, or null for a generic publisher of type_name
+static rmw_publisher_t *
+create_publisher(
   const rmw_node_t * node,
   const rosidl_message_type_support_t * type_supports,
+  const char * type_name,
   const char * topic_name,
   const rmw_qos_profile_t * rmw_qos,
   const rmw_publisher_options_t * publisher_options)
@@ -103,13 +139,15 @@ rmw_create_publisher(
   rmw_publisher_t * publisher = nullptr;
   try {
     publisher = create_initial_publisher(publisher_options);
-    auto dds_pub = DDSPublisher::Raf::create(dds_node->dp(), type_supports, topic_name, rmw_qos);
+    auto options = static_cast<const rmw_opendds_publisher_options_t *>(
+      publisher->options.rmw_specific_publisher_payload);
+    auto dds_pub = DDSPublisher::Raf::create(dds_node, type_supports, type_name, topic_name, rmw_qos, options);
     if (!dds_pub) {
       throw std::runtime_error("DDSPublisher failed");
     }
     publisher->data = dds_pub;
     publisher->topic_name = dds_pub->topic_name().c_str();
-    dds_node->add_pub(dds_pub->instance_handle(), dds_pub->topic_name(), dds_pub->topic_type());
+    dds_node->add_pub(dds_pub->get_entity(), dds_pub->topic_name(), dds_pub->topic_type());
     return publisher;
   } catch (const std::exception& e) {
     RMW_SET_ERROR_MSG(e.what());
@@ -120,6 +158,36 @@ rmw_create_publisher(
   return nullptr;
 }
 
+rmw_publisher_t *
+rmw_create_publisher(
+  const rmw_node_t * node,
+  const rosidl_message_type_support_t * type_supports,
+  const char * topic_name,
+  const rmw_qos_profile_t * rmw_qos,
+  const rmw_publisher_options_t * publisher_options)
+{
+  if (!type_supports) {
+    RMW_SET_ERROR_MSG("type_supports is null");
+    return nullptr;
+  }
+  return create_publisher(node, type_supports, nullptr, topic_name, rmw_qos, publisher_options);
+}
+
+rmw_publisher_t *
+rmw_opendds_create_generic_publisher(
+  const rmw_node_t * node,
+  const char * type_name,
+  const char * topic_name,
+  const rmw_qos_profile_t * qos_profile,
+  const rmw_publisher_options_t * publisher_options)
+{
+  if (!type_name) {
+    RMW_SET_ERROR_MSG("type_name is null");
+    return nullptr;
+  }
+  return create_publisher(node, nullptr, type_name, topic_name, qos_profile, publisher_options);
+}
+
 rmw_ret_t
 rmw_publisher_count_matched_subscriptions(
   const rmw_publisher_t * publisher,
@@ -211,7 +279,7 @@ rmw_destroy_publisher(rmw_node_t * node, rmw_publisher_t * publisher)
   if (!dds_pub) {
     return RMW_RET_ERROR; // error set
   }
-  bool ret = dds_node->remove_pub(dds_pub->instance_handle());
+  bool ret = dds_node->remove_pub(dds_pub->get_entity());
   if (ret) {
     clean_publisher(publisher);
   }
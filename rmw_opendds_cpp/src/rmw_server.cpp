@@ -65,7 +65,7 @@ rmw_create_service(
     }
     service->implementation_identifier = opendds_identifier;
     service->data = nullptr;
-    auto dds_server = DDSServer::Raf::create(type_supports, service_name, rmw_qos, dds_node->dp());
+    auto dds_server = DDSServer::Raf::create(type_supports, service_name, rmw_qos, dds_node);
     if (!dds_server) {
       throw std::runtime_error("DDSServer failed");
     }
@@ -14,6 +14,7 @@
 
 #include <rmw_opendds_cpp/DDSSubscriber.hpp>
 #include <rmw_opendds_cpp/OpenDDSNode.hpp>
+#include <rmw_opendds_cpp/generic_endpoint.h>
 #include <rmw_opendds_cpp/identifier.hpp>
 #include <rmw_opendds_cpp/qos.hpp>
 #include <rmw_opendds_cpp/types.hpp>
@@ -34,6 +35,16 @@
 
 extern "C"
 {
+rmw_opendds_subscription_options_t
+rmw_opendds_get_default_subscription_options(void)
+{
+  rmw_opendds_subscription_options_t options;
+  options.compression = RMW_OPENDDS_COMPRESSION_NONE;
+  options.max_decompressed_size = 0;
+  options.delta = false;
+  return options;
+}
+
 rmw_ret_t
 rmw_init_subscription_allocation(
   const rosidl_message_type_support_t * type_support,
@@ -88,10 +99,12 @@ rmw_subscription_t * create_initial_subscription(const rmw_subscription_options_
   return subscription;
 }
 
-rmw_subscription_t *
-rmw_create_subscription(
+// type_supports, or null for a generic subscription of type_name
+static rmw_subscription_t *
+create_subscription(
   const rmw_node_t * node,
   const rosidl_message_type_support_t * type_supports,
+  const char * type_name,
   const char * topic_name,
   const rmw_qos_profile_t * rmw_qos,
   const rmw_subscription_options_t * subscription_options)
@@ -103,13 +116,15 @@ rmw_create_subscription(
   rmw_subscription_t * subscription = nullptr;
   try {
     subscription = create_initial_subscription(subscription_options);
-    auto dds_sub = DDSSubscriber::Raf::create(dds_node->dp(), type_supports, topic_name, rmw_qos);
+    auto options = static_cast<const rmw_opendds_subscription_options_t *>(
+      subscription->options.rmw_specific_subscription_payload);
+    auto dds_sub = DDSSubscriber::Raf::create(dds_node, type_supports, type_name, topic_name, rmw_qos, options);
     if (!dds_sub) {
       throw std::runtime_error("DDSSubscriber failed");
     }
     subscription->data = dds_sub;
     subscription->topic_name = dds_sub->topic_name().c_str();
-    dds_node->add_sub(dds_sub->instance_handle(), dds_sub->topic_name(), dds_sub->topic_type());
+    dds_node->add_sub(dds_sub->get_entity(), dds_sub->topic_name(), dds_sub->topic_type());
     return subscription;
   } catch (const std::exception& e) {
     RMW_SET_ERROR_MSG(e.what());
@@ -120,6 +135,36 @@ rmw_create_subscription(
   return nullptr;
 }
 
+rmw_subscription_t *
+rmw_create_subscription(
+  const rmw_node_t * node,
+  const rosidl_message_type_support_t * type_supports,
+  const char * topic_name,
+  const rmw_qos_profile_t * rmw_qos,
+  const rmw_subscription_options_t * subscription_options)
+{
+  if (!type_supports) {
+    RMW_SET_ERROR_MSG("type_supports is null");
+    return nullptr;
+  }
+  return create_subscription(node, type_supports, nullptr, topic_name, rmw_qos, subscription_options);
+}
+
+rmw_subscription_t *
+rmw_opendds_create_generic_subscription(
+  const rmw_node_t * node,
+  const char * type_name,
+  const char * topic_name,
+  const rmw_qos_profile_t * qos_profile,
+  const rmw_subscription_options_t * subscription_options)
+{
+  if (!type_name) {
+    RMW_SET_ERROR_MSG("type_name is null");
+    return nullptr;
+  }
+  return create_subscription(node, nullptr, type_name, topic_name, qos_profile, subscription_options);
+}
+
 rmw_ret_t
 rmw_subscription_count_matched_publishers(
   const rmw_subscription_t * subscription,
@@ -166,7 +211,7 @@ rmw_destroy_subscription(rmw_node_t * node, rmw_subscription_t * subscription)
   if (!dds_sub) {
     return RMW_RET_ERROR; // error set
   }
-  bool ret = dds_node->remove_sub(dds_sub->instance_handle());
+  bool ret = dds_node->remove_sub(dds_sub->get_entity());
   if (ret) {
     clean_subscription(subscription);
   }
@@ -13,7 +13,10 @@
 // limitations under the License.
 
 #include <rmw_opendds_cpp/DDSSubscriber.hpp>
+#include <rmw_opendds_cpp/compression.hpp>
+#include <rmw_opendds_cpp/delta.hpp>
 #include <rmw_opendds_cpp/identifier.hpp>
+#include <rmw_opendds_cpp/trace.hpp>
 #include <rmw_opendds_cpp/types.hpp>
 
 #include <rmw/error_handling.h>
@@ -24,8 +27,71 @@
 
 static const size_t buffer_max = (std::numeric_limits<CORBA::ULong>::max)();
 
+// Rebuild a compressed or delta encoded sample into cdr_stream: RMW_RET_UNSUPPORTED if
+// the sample holds the CDR stream as it is, from buffer for length bytes, RMW_RET_OK if
+// cdr_stream holds it, an error otherwise. A delta whose base was lost sets gap instead
+// of the error.
+static rmw_ret_t
+decode(
+  DDSSubscriber & dds_sub,
+  DDS::InstanceHandle_t publication,
+  const uint8_t *& buffer,
+  size_t & length,
+  rmw_serialized_message_t & cdr_stream,
+  bool & gap)
+{
+  gap = false;
+  bool compressed = false;
+  if (dds_sub.compression() != RMW_OPENDDS_COMPRESSION_NONE) {
+    PayloadFormat format;
+    if (!payload_format(buffer, length, format)) {
+      RMW_SET_ERROR_MSG("sample of unknown format");
+      return RMW_RET_ERROR;
+    }
+    buffer += payload_header_length;
+    length -= payload_header_length;
+    compressed = format == PayloadFormat::Zstd;
+  }
+  DeltaDecoder * delta = dds_sub.delta();
+  if (!delta) {
+    return compressed ? decompress(buffer, length, dds_sub.max_decompressed_size(), cdr_stream) : RMW_RET_UNSUPPORTED;  // error set
+  }
+  const uint8_t * frame_buffer = buffer;
+  size_t frame_length = length;
+  rcutils_uint8_array_t frame = {nullptr, 0lu, 0lu, cdr_stream.allocator};
+  if (compressed) {
+    const rmw_ret_t ret = decompress(buffer, length, dds_sub.max_decompressed_size(), frame);  // error set
+    if (ret != RMW_RET_OK) {
+      return ret;
+    }
+    frame_buffer = frame.buffer;
+    frame_length = frame.buffer_length;
+  }
+  // every frame is decoded, filtered or not, to keep the state of its writer
+  rmw_ret_t ret = RMW_RET_ERROR;
+  switch (delta->decode(publication, frame_buffer, frame_length, cdr_stream)) {
+    case DeltaDecoder::Decoded:
+      ret = RMW_RET_OK;
+      break;
+    case DeltaDecoder::Gap:
+      gap = true;
+      break;
+    case DeltaDecoder::Invalid:
+      RMW_SET_ERROR_MSG("invalid delta frame");
+      break;
+    case DeltaDecoder::BadAlloc:
+      dds_sub.stats().allocation_failures.add(1);
+      RMW_SET_ERROR_MSG("failed to allocate memory for delta decoding");
+      ret = RMW_RET_BAD_ALLOC;
+      break;
+  }
+  frame.allocator.deallocate(frame.buffer, frame.allocator.state);
+  return ret;
+}
+
 static rmw_ret_t
 take(
+  const rmw_subscription_t * subscription,
   DDSSubscriber & dds_sub,
   rmw_serialized_message_t * cdr_stream,
   bool & taken,
@@ -41,33 +107,93 @@ take(
 
   OpenDDSStaticSerializedDataSeq msgs;
   DDS::SampleInfoSeq infos;
-  DDS::ReturnCode_t rc = reader->take(msgs, infos, 1, DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+  SubscriberStats & stats = dds_sub.stats();
+  RMW_OPENDDS_TRACE(take_entry, subscription);
+  const uint64_t start = stats_now_ns();
+  DDS::ReturnCode_t rc = DDS::RETCODE_NO_DATA;
+  rmw_ret_t decoded = RMW_RET_UNSUPPORTED;  // RMW_RET_OK: cdr_stream holds the sample
+  // OpenDDS does not expose when a sample was received, so the start of its take is the
+  // reception: the take and the deserialization are not part of the latency
+  LatencyHistogram * latency = dds_sub.recording_latency_histogram();
+  int64_t received_ns = 0;
+  // the CDR stream a sample holds as it is
+  const uint8_t * cdr = nullptr;
+  size_t cdr_length = 0;
+  // samples rejected by the filter of the subscription are dropped before they are copied,
+  // and deltas whose base was lost until the next keyframe; the latency of each is recorded
+  for (;;) {
+    if (latency || message_info) {
+      received_ns = wall_now_ns();
+    }
+    rc = reader->take(msgs, infos, 1, DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+    if (DDS::RETCODE_OK != rc || !infos[0].valid_data) {
+      break;
+    }
+    if (latency) {
+      latency->record(received_ns - source_timestamp_ns(infos[0]));
+    }
+    cdr = msgs[0].serialized_data.get_buffer();
+    cdr_length = msgs[0].serialized_data.length();
+    bool gap = false;
+    decoded = decode(dds_sub, infos[0].publication_handle, cdr, cdr_length, *cdr_stream, gap);
+    if (decoded == RMW_RET_UNSUPPORTED) {
+      if (dds_sub.accepts(cdr, cdr_length)) {
+        break;
+      }
+      stats.filtered.add(1);
+    } else if (gap) {
+      stats.delta_gaps.add(1);
+    } else if (decoded != RMW_RET_OK || dds_sub.accepts(cdr_stream->buffer, cdr_stream->buffer_length)) {
+      break;
+    } else {
+      cdr_stream->allocator.deallocate(cdr_stream->buffer, cdr_stream->allocator.state);
+      cdr_stream->buffer = nullptr;
+      cdr_stream->buffer_length = 0;
+      cdr_stream->buffer_capacity = 0;
+      stats.filtered.add(1);
+    }
+    decoded = RMW_RET_UNSUPPORTED;
+    reader->return_loan(msgs, infos);
+  }
+  stats.take_ns.add(stats_now_ns() - start);
+  RMW_OPENDDS_TRACE(take_exit, subscription, rc, DDS::RETCODE_OK == rc ? msgs[0].serialized_data.length() : 0);
   if (DDS::RETCODE_OK == rc) {
     DDS::SampleInfo & info = infos[0];
     if (info.valid_data) {
       const size_t length = msgs[0].serialized_data.length();
-      if (length <= buffer_max) {
-        cdr_stream->buffer_length = length;
-        cdr_stream->buffer_capacity = length;
-        cdr_stream->buffer = (uint8_t *)cdr_stream->allocator.allocate(length, cdr_stream->allocator.state);
+      if (decoded != RMW_RET_UNSUPPORTED) {
+        taken = decoded == RMW_RET_OK;  // error set otherwise
+      } else if (cdr_length <= buffer_max) {
+        cdr_stream->buffer_length = cdr_length;
+        cdr_stream->buffer_capacity = cdr_length;
+        cdr_stream->buffer = (uint8_t *)cdr_stream->allocator.allocate(cdr_length, cdr_stream->allocator.state);
         if (cdr_stream->buffer) {
-          std::memcpy(cdr_stream->buffer, msgs[0].serialized_data.get_buffer(), length);
+          std::memcpy(cdr_stream->buffer, cdr, cdr_length);
           taken = true;
-
-          if (message_info) {
-            message_info->publisher_gid.implementation_identifier = opendds_identifier;
-            memset(message_info->publisher_gid.data, 0, RMW_GID_STORAGE_SIZE);
-            auto detail = reinterpret_cast<OpenDDSPublisherGID *>(message_info->publisher_gid.data);
-            detail->publication_handle = info.publication_handle;
-          }
         } else {
+          stats.allocation_failures.add(1);
           RMW_SET_ERROR_MSG("failed to allocate memory for uint8 array");
         }
       } else {
         RMW_SET_ERROR_MSG("dds message length > buffer_max");
       }
+      if (taken) {
+        stats.messages.add(1);
+        stats.bytes.add(length);
+
+        if (message_info) {
+          message_info->publisher_gid.implementation_identifier = opendds_identifier;
+          memset(message_info->publisher_gid.data, 0, RMW_GID_STORAGE_SIZE);
+          auto detail = reinterpret_cast<OpenDDSPublisherGID *>(message_info->publisher_gid.data);
+          detail->guid = dds_sub.publisher_guid(info.publication_handle);
+          message_info->source_timestamp = source_timestamp_ns(info);
+          message_info->received_timestamp = received_ns;
+        }
+      }
     }
-  } else if (DDS::RETCODE_NO_DATA != rc) {
+  } else if (DDS::RETCODE_NO_DATA == rc) {
+    stats.take_misses.add(1);
+  } else {
     RMW_SET_ERROR_MSG("take failed");
   }
 
@@ -89,10 +215,14 @@ take(
   }
   RMW_CHECK_FOR_NULL_WITH_MSG(taken, "taken is null", return RMW_RET_ERROR);
   rcutils_uint8_array_t cdr_stream = {nullptr, 0lu, 0lu, rcutils_get_default_allocator()};
-  rmw_ret_t ret = take(*dds_sub, &cdr_stream, *taken, message_info);
+  rmw_ret_t ret = take(subscription, *dds_sub, &cdr_stream, *taken, message_info);
   if (RMW_RET_OK == ret) {
-    if (taken) {
+    if (*taken) {
+      RMW_OPENDDS_TRACE(deserialize_entry, subscription, ros_message);
+      const uint64_t start = stats_now_ns();
       ret = dds_sub->to_ros_message(cdr_stream, ros_message);
+      dds_sub->stats().deserialize_ns.add(stats_now_ns() - start);
+      RMW_OPENDDS_TRACE(deserialize_exit, subscription, ros_message);
       cdr_stream.allocator.deallocate(cdr_stream.buffer, cdr_stream.allocator.state);
     }
   }
@@ -134,7 +264,7 @@ rmw_take_serialized_message(
   if (!dds_sub) {
     return RMW_RET_ERROR;
   }
-  return take(*dds_sub, serialized_msg, *taken, nullptr);
+  return take(subscription, *dds_sub, serialized_msg, *taken, nullptr);
 }
 
 rmw_ret_t
@@ -150,7 +280,7 @@ rmw_take_serialized_message_with_info(
     return RMW_RET_ERROR;
   }
   RMW_CHECK_FOR_NULL_WITH_MSG(message_info, "message info is null", return RMW_RET_ERROR);
-  return take(*dds_sub, serialized_msg, *taken, message_info);
+  return take(subscription, *dds_sub, serialized_msg, *taken, message_info);
 }
 
 rmw_ret_t
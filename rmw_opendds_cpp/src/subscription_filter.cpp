@@ -0,0 +1,45 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/subscription_filter.h>
+#include <rmw_opendds_cpp/DDSSubscriber.hpp>
+
+extern "C"
+{
+rmw_ret_t
+rmw_opendds_set_subscription_filter(
+  const rmw_subscription_t * subscription,
+  rmw_opendds_sample_filter_t filter,
+  void * arg)
+{
+  auto dds_sub = DDSSubscriber::from(subscription);
+  if (!dds_sub) {
+    return RMW_RET_ERROR; // error set
+  }
+  dds_sub->set_filter(filter, arg);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_opendds_set_subscription_minimum_separation(
+  const rmw_subscription_t * subscription,
+  rmw_time_t separation)
+{
+  auto dds_sub = DDSSubscriber::from(subscription);
+  if (!dds_sub) {
+    return RMW_RET_ERROR; // error set
+  }
+  return dds_sub->set_minimum_separation(separation);
+}
+}  // extern "C"
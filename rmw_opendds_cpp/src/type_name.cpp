@@ -0,0 +1,41 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/type_name.hpp>
+
+#include <stdexcept>
+
+std::string dds_type_name(const std::string & type_name)
+{
+  if (type_name.find("::") != std::string::npos) {
+    return type_name;
+  }
+  const size_t slash = type_name.rfind('/');
+  if (slash == std::string::npos || slash == 0 || slash + 1 == type_name.size()) {
+    throw std::runtime_error("type name '" + type_name + "' is not of the form pkg/msg/Type");
+  }
+  std::string ns = type_name.substr(0, slash);
+  if (ns.find('/') == std::string::npos) {
+    ns += "/msg";
+  }
+  std::string dds_ns;
+  for (size_t begin = 0, end; begin <= ns.size(); begin = end + 1) {
+    end = ns.find('/', begin);
+    if (end == std::string::npos) {
+      end = ns.size();
+    }
+    dds_ns += ns.substr(begin, end - begin) + "::";
+  }
+  return dds_ns + "dds_::" + type_name.substr(slash + 1) + "_";
+}
@@ -15,6 +15,7 @@
 #include <rmw_opendds_cpp/namespace_prefix.hpp>
 #include <rmw_opendds_cpp/demangle.hpp>
 #include <rmw_opendds_cpp/guid_helper.hpp>
+#include <rmw_opendds_cpp/trace.hpp>
 #include <rmw_opendds_cpp/types.hpp>
 
 #include <rmw/error_handling.h>
@@ -42,6 +43,8 @@ bool CustomDataReaderListener::add_information(
 
   // store topic name and type name
   bool success = topic_cache.add_topic(participant_guid, guid, topic_name, type_name);
+  RMW_OPENDDS_TRACE(add_information, reinterpret_cast<const uint8_t *>(&guid),
+    topic_name.c_str(), type_name.c_str(), static_cast<int>(entity_type));
 
 #ifdef DISCOVERY_DEBUG_LOGGING
   std::stringstream ss;
@@ -65,6 +68,7 @@ bool CustomDataReaderListener::remove_information(
 
   // remove entries
   bool success = topic_cache.remove_topic(guid);
+  RMW_OPENDDS_TRACE(remove_information, reinterpret_cast<const uint8_t *>(&guid), static_cast<int>(entity_type));
 #ifdef DISCOVERY_DEBUG_LOGGING
   std::stringstream ss;
   ss << guid;
@@ -0,0 +1,107 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/bounded_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST(BoundedQueue, capacity_is_rounded_up) {
+  BoundedQueue<int> queue(3);
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(queue.push(i));
+  }
+  EXPECT_FALSE(queue.push(4));
+  EXPECT_FALSE(queue.empty());
+}
+
+TEST(BoundedQueue, fifo) {
+  BoundedQueue<int> queue(8);
+  int value = -1;
+  EXPECT_FALSE(queue.pop(value));
+  // wraps around the cells several times
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < 6; ++i) {
+      ASSERT_TRUE(queue.push(round * 10 + i));
+    }
+    for (int i = 0; i < 6; ++i) {
+      ASSERT_TRUE(queue.pop(value));
+      EXPECT_EQ(round * 10 + i, value);
+    }
+    EXPECT_FALSE(queue.pop(value));
+    EXPECT_TRUE(queue.empty());
+  }
+}
+
+// Producers and consumers contend on a small queue: every value pushed is popped
+// exactly once, and the values of each producer in the order they were pushed.
+TEST(BoundedQueue, stress) {
+  const int producers = 4;
+  const int consumers = 4;
+  const uint64_t per_producer = 200000;
+  BoundedQueue<uint64_t> queue(16);
+  std::atomic<int> producing(producers);
+  std::atomic<uint64_t> popped(0);
+  std::atomic<uint64_t> sum(0);
+  std::atomic<bool> ordered(true);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p]() {
+      for (uint64_t i = 0; i < per_producer; ++i) {
+        const uint64_t value = static_cast<uint64_t>(p) << 32 | i;
+        while (!queue.push(value)) {
+          std::this_thread::yield();
+        }
+      }
+      --producing;
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&]() {
+      std::vector<int64_t> last(producers, -1);
+      uint64_t value = 0;
+      for (;;) {
+        if (queue.pop(value)) {
+          const int p = static_cast<int>(value >> 32);
+          const int64_t i = static_cast<int64_t>(value & 0xffffffff);
+          if (i <= last[p]) {
+            ordered = false;
+          }
+          last[p] = i;
+          sum += i;
+          ++popped;
+        } else if (!producing && queue.empty()) {
+          return;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(producers * per_producer, popped.load());
+  EXPECT_EQ(producers * per_producer * (per_producer - 1) / 2, sum.load());
+  EXPECT_TRUE(ordered);
+  uint64_t value = 0;
+  EXPECT_FALSE(queue.pop(value));
+}
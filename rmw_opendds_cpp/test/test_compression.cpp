@@ -0,0 +1,139 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/compression.hpp>
+
+#include <rcutils/allocator.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// A CDR stream that compresses well.
+std::vector<uint8_t> message(size_t length)
+{
+  std::vector<uint8_t> data(length, 0);
+  data[1] = 1;
+  for (size_t i = 4; i < length; i += 97) {
+    data[i] = static_cast<uint8_t>(i);
+  }
+  return data;
+}
+
+PayloadFormat format_of(const uint8_t * data, size_t length)
+{
+  PayloadFormat format = PayloadFormat::Plain;
+  EXPECT_TRUE(payload_format(data, length, format));
+  return format;
+}
+
+}  // namespace
+
+TEST(Compression, partitions) {
+  EXPECT_EQ("", encoding_partition(RMW_OPENDDS_COMPRESSION_NONE, false));
+  EXPECT_EQ("rmw_opendds_zstd", encoding_partition(RMW_OPENDDS_COMPRESSION_ZSTD, false));
+  EXPECT_EQ("rmw_opendds_delta", encoding_partition(RMW_OPENDDS_COMPRESSION_NONE, true));
+  EXPECT_EQ("rmw_opendds_zstd_delta", encoding_partition(RMW_OPENDDS_COMPRESSION_ZSTD, true));
+}
+
+TEST(Compression, payload_format) {
+  PayloadFormat format = PayloadFormat::Zstd;
+  const uint8_t plain[] = {0, 1, 2};
+  EXPECT_TRUE(payload_format(plain, sizeof(plain), format));
+  EXPECT_EQ(PayloadFormat::Plain, format);
+  const uint8_t zstd[] = {1, 0x28, 0xb5, 0x2f, 0xfd};
+  EXPECT_TRUE(payload_format(zstd, sizeof(zstd), format));
+  EXPECT_EQ(PayloadFormat::Zstd, format);
+  // a CDR stream with no format byte is not taken for a compressed one
+  const uint8_t unknown[] = {0x28, 0xb5, 0x2f, 0xfd};
+  EXPECT_FALSE(payload_format(unknown, sizeof(unknown), format));
+  EXPECT_FALSE(payload_format(unknown, 0, format));
+}
+
+TEST(Compression, small_messages_are_sent_plain) {
+  const std::vector<uint8_t> data = message(100);
+  size_t length = 0;
+  const uint8_t * encoded = encode_payload(data.data(), data.size(), 1024, 3, length);
+  ASSERT_EQ(payload_header_length + data.size(), length);
+  EXPECT_EQ(PayloadFormat::Plain, format_of(encoded, length));
+  EXPECT_EQ(data, std::vector<uint8_t>(encoded + payload_header_length, encoded + length));
+}
+
+#ifdef RMW_OPENDDS_CPP_ZSTD
+
+TEST(Compression, round_trip) {
+  const std::vector<uint8_t> data = message(100000);
+  size_t length = 0;
+  const uint8_t * encoded = encode_payload(data.data(), data.size(), 1024, 3, length);
+  EXPECT_LT(length, data.size());
+  EXPECT_EQ(PayloadFormat::Zstd, format_of(encoded, length));
+
+  rcutils_uint8_array_t cdr_stream = rcutils_get_zero_initialized_uint8_array();
+  cdr_stream.allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(RMW_RET_OK,
+    decompress(encoded + payload_header_length, length - payload_header_length, data.size(), cdr_stream));
+  EXPECT_EQ(data, std::vector<uint8_t>(cdr_stream.buffer, cdr_stream.buffer + cdr_stream.buffer_length));
+  cdr_stream.allocator.deallocate(cdr_stream.buffer, cdr_stream.allocator.state);
+}
+
+TEST(Compression, incompressible_messages_are_sent_plain) {
+  std::vector<uint8_t> data(4096);
+  uint32_t x = 12345;
+  for (auto & byte : data) {
+    x = x * 1103515245 + 12345;
+    byte = static_cast<uint8_t>(x >> 24);
+  }
+  size_t length = 0;
+  const uint8_t * encoded = encode_payload(data.data(), data.size(), 1024, 3, length);
+  ASSERT_EQ(payload_header_length + data.size(), length);
+  EXPECT_EQ(PayloadFormat::Plain, format_of(encoded, length));
+}
+
+TEST(Compression, invalid_frames) {
+  const uint8_t garbage[] = {0x28, 0xb5, 0x2f, 0xfd, 0, 0};
+  rcutils_uint8_array_t cdr_stream = rcutils_get_zero_initialized_uint8_array();
+  cdr_stream.allocator = rcutils_get_default_allocator();
+  EXPECT_NE(RMW_RET_OK, decompress(garbage, sizeof(garbage), default_max_decompressed_size, cdr_stream));
+  EXPECT_EQ(nullptr, cdr_stream.buffer);
+}
+
+TEST(Compression, declared_size_is_capped) {
+  const std::vector<uint8_t> data = message(100000);
+  size_t length = 0;
+  const uint8_t * encoded = encode_payload(data.data(), data.size(), 1024, 3, length);
+  ASSERT_EQ(PayloadFormat::Zstd, format_of(encoded, length));
+  rcutils_uint8_array_t cdr_stream = rcutils_get_zero_initialized_uint8_array();
+  cdr_stream.allocator = rcutils_get_default_allocator();
+  EXPECT_EQ(RMW_RET_ERROR,
+    decompress(encoded + payload_header_length, length - payload_header_length, data.size() - 1, cdr_stream));
+  EXPECT_EQ(nullptr, cdr_stream.buffer);
+
+  // a frame header declaring 4 GiB - 1 of content
+  const uint8_t hostile[] = {0x28, 0xb5, 0x2f, 0xfd, 0xa0, 0xff, 0xff, 0xff, 0xff, 0, 0, 0};
+  EXPECT_EQ(RMW_RET_ERROR, decompress(hostile, sizeof(hostile), default_max_decompressed_size, cdr_stream));
+  EXPECT_EQ(nullptr, cdr_stream.buffer);
+}
+
+#else
+
+TEST(Compression, unsupported) {
+  EXPECT_NO_THROW(check_compression(RMW_OPENDDS_COMPRESSION_NONE));
+  EXPECT_THROW(check_compression(RMW_OPENDDS_COMPRESSION_ZSTD), std::runtime_error);
+}
+
+#endif
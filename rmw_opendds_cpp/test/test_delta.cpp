@@ -0,0 +1,184 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/delta.hpp>
+
+#include <rcutils/allocator.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+const DDS::InstanceHandle_t writer = 7;
+
+std::vector<uint8_t> message(size_t length)
+{
+  std::vector<uint8_t> data(length);
+  for (size_t i = 0; i < length; ++i) {
+    data[i] = static_cast<uint8_t>(i * 31);
+  }
+  return data;
+}
+
+bool is_keyframe(const std::vector<uint8_t> & frame)
+{
+  return frame.size() > 1 && frame[1] == 'K';
+}
+
+// Decode frame and check that it rebuilds expected.
+DeltaDecoder::Result decode(DeltaDecoder & decoder, const std::vector<uint8_t> & frame,
+  const std::vector<uint8_t> & expected, DDS::InstanceHandle_t publication = writer)
+{
+  rcutils_uint8_array_t cdr_stream = rcutils_get_zero_initialized_uint8_array();
+  cdr_stream.allocator = rcutils_get_default_allocator();
+  const DeltaDecoder::Result result = decoder.decode(publication, frame.data(), frame.size(), cdr_stream);
+  if (result == DeltaDecoder::Decoded) {
+    EXPECT_EQ(expected, std::vector<uint8_t>(cdr_stream.buffer, cdr_stream.buffer + cdr_stream.buffer_length));
+  }
+  cdr_stream.allocator.deallocate(cdr_stream.buffer, cdr_stream.allocator.state);
+  return result;
+}
+
+}  // namespace
+
+TEST(Delta, keyframe_then_deltas) {
+  DeltaEncoder encoder(10);
+  DeltaDecoder decoder;
+  std::vector<uint8_t> data = message(10000);
+  std::vector<uint8_t> frame = encoder.encode(data.data(), data.size());
+  EXPECT_TRUE(is_delta_frame(frame.data(), frame.size()));
+  EXPECT_TRUE(is_keyframe(frame));
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, frame, data));
+
+  for (int i = 0; i < 5; ++i) {
+    data[100 * i + 5] ^= 0xff;
+    data[9000 - i] ^= 0xff;
+    frame = encoder.encode(data.data(), data.size());
+    EXPECT_FALSE(is_keyframe(frame));
+    EXPECT_LT(frame.size(), data.size() / 10);
+    EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, frame, data));
+  }
+}
+
+TEST(Delta, keyframe_interval) {
+  DeltaEncoder encoder(3);
+  std::vector<uint8_t> data = message(1000);
+  std::vector<bool> keyframes;
+  for (int i = 0; i < 7; ++i) {
+    data[i] ^= 0xff;
+    keyframes.push_back(is_keyframe(encoder.encode(data.data(), data.size())));
+  }
+  EXPECT_EQ((std::vector<bool>{true, false, false, true, false, false, true}), keyframes);
+}
+
+TEST(Delta, large_changes_and_resizes_send_keyframes) {
+  DeltaEncoder encoder(100);
+  std::vector<uint8_t> data = message(1000);
+  encoder.encode(data.data(), data.size());
+  for (auto & byte : data) {
+    byte ^= 0xff;
+  }
+  EXPECT_TRUE(is_keyframe(encoder.encode(data.data(), data.size())));
+  data.resize(900);
+  EXPECT_TRUE(is_keyframe(encoder.encode(data.data(), data.size())));
+}
+
+TEST(Delta, gap_until_keyframe) {
+  DeltaEncoder encoder(4);
+  DeltaDecoder decoder;
+  std::vector<uint8_t> data = message(1000);
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, encoder.encode(data.data(), data.size()), data));
+  data[1] ^= 0xff;
+  encoder.encode(data.data(), data.size());  // lost
+  data[2] ^= 0xff;
+  EXPECT_EQ(DeltaDecoder::Gap, decode(decoder, encoder.encode(data.data(), data.size()), data));
+  data[3] ^= 0xff;
+  EXPECT_EQ(DeltaDecoder::Gap, decode(decoder, encoder.encode(data.data(), data.size()), data));
+  data[4] ^= 0xff;
+  const std::vector<uint8_t> keyframe = encoder.encode(data.data(), data.size());
+  EXPECT_TRUE(is_keyframe(keyframe));
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, keyframe, data));
+  data[5] ^= 0xff;
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, encoder.encode(data.data(), data.size()), data));
+}
+
+TEST(Delta, reset_sends_a_keyframe) {
+  DeltaEncoder encoder(100);
+  DeltaDecoder decoder;
+  std::vector<uint8_t> data = message(1000);
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, encoder.encode(data.data(), data.size()), data));
+  data[1] ^= 0xff;
+  encoder.encode(data.data(), data.size());  // not written
+  encoder.reset();
+  data[2] ^= 0xff;
+  const std::vector<uint8_t> frame = encoder.encode(data.data(), data.size());
+  EXPECT_TRUE(is_keyframe(frame));
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, frame, data));
+}
+
+TEST(Delta, writers_are_decoded_apart) {
+  DeltaEncoder a(100);
+  DeltaEncoder b(100);
+  DeltaDecoder decoder;
+  std::vector<uint8_t> data_a = message(1000);
+  std::vector<uint8_t> data_b = message(500);
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, a.encode(data_a.data(), data_a.size()), data_a, 1));
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, b.encode(data_b.data(), data_b.size()), data_b, 2));
+  data_a[10] ^= 0xff;
+  data_b[20] ^= 0xff;
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, b.encode(data_b.data(), data_b.size()), data_b, 2));
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, a.encode(data_a.data(), data_a.size()), data_a, 1));
+}
+
+TEST(Delta, retain_forgets_unmatched_writers) {
+  DeltaEncoder encoder(100);
+  DeltaDecoder decoder;
+  std::vector<uint8_t> data = message(1000);
+  const std::vector<uint8_t> keyframe = encoder.encode(data.data(), data.size());
+  for (DDS::InstanceHandle_t publication = 1; publication <= 3; ++publication) {
+    EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, keyframe, data, publication));
+  }
+  EXPECT_EQ(3u, decoder.writers());
+
+  DDS::InstanceHandleSeq matched;
+  matched.length(1);
+  matched[0] = 2;
+  decoder.retain(matched);
+  EXPECT_EQ(1u, decoder.writers());
+  data[1] ^= 0xff;
+  const std::vector<uint8_t> delta = encoder.encode(data.data(), data.size());
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, delta, data, 2));
+  // a writer matched again starts over from a keyframe
+  EXPECT_EQ(DeltaDecoder::Gap, decode(decoder, delta, data, 1));
+
+  decoder.retain(DDS::InstanceHandleSeq());
+  EXPECT_EQ(0u, decoder.writers());
+}
+
+TEST(Delta, invalid_frames) {
+  DeltaDecoder decoder;
+  const std::vector<uint8_t> data;
+  EXPECT_EQ(DeltaDecoder::Invalid, decode(decoder, std::vector<uint8_t>{0, 1, 0, 0}, data));
+  EXPECT_EQ(DeltaDecoder::Invalid, decode(decoder, std::vector<uint8_t>{'D', 'X', 0, 0, 1, 0, 0, 0}, data));
+  DeltaEncoder encoder(100);
+  std::vector<uint8_t> message_data = message(100);
+  EXPECT_EQ(DeltaDecoder::Decoded, decode(decoder, encoder.encode(message_data.data(), message_data.size()),
+    message_data));
+  // a range past the end of the message
+  std::vector<uint8_t> frame{'D', 'D', 0, 0, 2, 0, 0, 0, 99, 0, 0, 0, 2, 0, 0, 0, 1, 2};
+  EXPECT_EQ(DeltaDecoder::Invalid, decode(decoder, frame, data));
+}
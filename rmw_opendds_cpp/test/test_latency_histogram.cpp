@@ -0,0 +1,131 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/EntityStats.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+rmw_opendds_latency_stats_t get(const LatencyHistogram & histogram)
+{
+  rmw_opendds_latency_stats_t stats;
+  histogram.get(stats);
+  return stats;
+}
+
+// Percentiles have a relative precision of 1/16.
+void expect_near(int64_t expected, int64_t actual)
+{
+  EXPECT_NEAR(static_cast<double>(expected), static_cast<double>(actual), expected / 16.0 + 1);
+}
+
+}  // namespace
+
+TEST(LatencyHistogram, empty) {
+  auto histogram = std::make_shared<LatencyHistogram>();
+  const rmw_opendds_latency_stats_t stats = get(*histogram);
+  EXPECT_EQ(0u, stats.count);
+  EXPECT_EQ(0u, stats.negative);
+  EXPECT_EQ(0, stats.min_ns);
+  EXPECT_EQ(0, stats.max_ns);
+  EXPECT_EQ(0, stats.p50_ns);
+  EXPECT_EQ(0, stats.p999_ns);
+}
+
+TEST(LatencyHistogram, small_values_are_exact) {
+  auto histogram = std::make_shared<LatencyHistogram>();
+  for (int64_t ns = 0; ns < 11; ++ns) {
+    histogram->record(ns);
+  }
+  const rmw_opendds_latency_stats_t stats = get(*histogram);
+  EXPECT_EQ(11u, stats.count);
+  EXPECT_EQ(0, stats.min_ns);
+  EXPECT_EQ(10, stats.max_ns);
+  EXPECT_EQ(5, stats.mean_ns);
+  EXPECT_EQ(5, stats.p50_ns);
+  EXPECT_EQ(9, stats.p90_ns);
+}
+
+TEST(LatencyHistogram, percentiles) {
+  auto histogram = std::make_shared<LatencyHistogram>();
+  for (int64_t i = 1; i <= 100000; ++i) {
+    histogram->record(i * 1000);
+  }
+  const rmw_opendds_latency_stats_t stats = get(*histogram);
+  EXPECT_EQ(100000u, stats.count);
+  EXPECT_EQ(1000, stats.min_ns);
+  EXPECT_EQ(100000000, stats.max_ns);
+  EXPECT_EQ(50000500, stats.mean_ns);
+  expect_near(50000000, stats.p50_ns);
+  expect_near(90000000, stats.p90_ns);
+  expect_near(99000000, stats.p99_ns);
+  expect_near(99900000, stats.p999_ns);
+  EXPECT_LE(stats.p999_ns, stats.max_ns);
+
+  // the largest values still have a bucket
+  histogram->record(INT64_MAX);
+  EXPECT_EQ(INT64_MAX, get(*histogram).max_ns);
+}
+
+TEST(LatencyHistogram, negative_values_are_counted_apart) {
+  auto histogram = std::make_shared<LatencyHistogram>();
+  histogram->record(-5);
+  histogram->record(100);
+  const rmw_opendds_latency_stats_t stats = get(*histogram);
+  EXPECT_EQ(2u, stats.count);
+  EXPECT_EQ(1u, stats.negative);
+  EXPECT_EQ(100, stats.min_ns);
+  EXPECT_EQ(100, stats.max_ns);
+  EXPECT_EQ(100, stats.mean_ns);
+  EXPECT_EQ(100, stats.p50_ns);
+}
+
+TEST(LatencyHistogram, reset) {
+  auto histogram = std::make_shared<LatencyHistogram>();
+  histogram->record(1000);
+  histogram->record(-1);
+  histogram->reset();
+  EXPECT_EQ(0u, get(*histogram).count);
+  EXPECT_EQ(0u, get(*histogram).negative);
+  histogram->record(7);
+  EXPECT_EQ(7, get(*histogram).min_ns);
+  EXPECT_EQ(7, get(*histogram).max_ns);
+}
+
+TEST(LatencyHistogram, concurrent_records) {
+  auto histogram = std::make_shared<LatencyHistogram>();
+  const int64_t per_thread = 100000;
+  std::vector<std::thread> threads;
+  for (int64_t t = 0; t < 4; ++t) {
+    threads.emplace_back([histogram, t, per_thread]() {
+        for (int64_t i = 0; i < per_thread; ++i) {
+          histogram->record(t * per_thread + i);
+        }
+      });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  const rmw_opendds_latency_stats_t stats = get(*histogram);
+  EXPECT_EQ(4u * per_thread, stats.count);
+  EXPECT_EQ(0, stats.min_ns);
+  EXPECT_EQ(4 * per_thread - 1, stats.max_ns);
+  EXPECT_EQ((4 * per_thread - 1) / 2, stats.mean_ns);
+}
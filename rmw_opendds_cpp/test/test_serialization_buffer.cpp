@@ -0,0 +1,100 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/SerializationBuffer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+// Serialize a message of length bytes as the type supports do, reallocating the buffer
+// only when it is too small.
+void serialize(rcutils_uint8_array_t & cdr_stream, size_t length)
+{
+  if (cdr_stream.buffer_capacity < length) {
+    cdr_stream.allocator.deallocate(cdr_stream.buffer, cdr_stream.allocator.state);
+    cdr_stream.buffer = static_cast<uint8_t *>(cdr_stream.allocator.allocate(length, cdr_stream.allocator.state));
+    cdr_stream.buffer_capacity = length;
+  }
+  std::memset(cdr_stream.buffer, 0x5a, length);
+  cdr_stream.buffer_length = length;
+}
+
+}  // namespace
+
+TEST(SerializationBuffer, stable_across_publishes) {
+  SerializationBuffer buffer;
+  serialize(buffer.get(), 1000);
+  const uint8_t * first = buffer.get().buffer;
+  ASSERT_NE(nullptr, first);
+  buffer.release();
+  EXPECT_EQ(0u, buffer.get().buffer_length);
+  serialize(buffer.get(), 800);
+  EXPECT_EQ(first, buffer.get().buffer);
+  buffer.release();
+  serialize(buffer.get(), 1000);
+  EXPECT_EQ(first, buffer.get().buffer);
+  buffer.release();
+}
+
+TEST(SerializationBuffer, shrinks_after_small_messages) {
+  const size_t period = SerializationBuffer::shrink_period;
+  const size_t large = 4 * SerializationBuffer::min_shrink_capacity;
+  SerializationBuffer buffer;
+  serialize(buffer.get(), large);
+  buffer.release();
+  for (size_t i = 1; i < period - 1; ++i) {
+    serialize(buffer.get(), 100);
+    buffer.release();
+  }
+  EXPECT_EQ(large, buffer.get().buffer_capacity);
+  // the large message counts in the period it was published in
+  serialize(buffer.get(), 100);
+  buffer.release();
+  EXPECT_EQ(large, buffer.get().buffer_capacity);
+  for (size_t i = 0; i < period; ++i) {
+    serialize(buffer.get(), 100);
+    buffer.release();
+  }
+  EXPECT_EQ(nullptr, buffer.get().buffer);
+  EXPECT_EQ(0u, buffer.get().buffer_capacity);
+}
+
+TEST(SerializationBuffer, keeps_a_buffer_in_use) {
+  const size_t period = SerializationBuffer::shrink_period;
+  const size_t large = 4 * SerializationBuffer::min_shrink_capacity;
+  SerializationBuffer buffer;
+  for (size_t i = 0; i < 3 * period; ++i) {
+    serialize(buffer.get(), i % 64 ? 100 : large);
+    buffer.release();
+  }
+  EXPECT_EQ(large, buffer.get().buffer_capacity);
+}
+
+TEST(SerializationBuffer, keeps_a_small_buffer) {
+  const size_t period = SerializationBuffer::shrink_period;
+  const size_t small = SerializationBuffer::min_shrink_capacity / 2;
+  SerializationBuffer buffer;
+  serialize(buffer.get(), small);
+  buffer.release();
+  for (size_t i = 0; i < 2 * period; ++i) {
+    serialize(buffer.get(), 10);
+    buffer.release();
+  }
+  EXPECT_EQ(small, buffer.get().buffer_capacity);
+}
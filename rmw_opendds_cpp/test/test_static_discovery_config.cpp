@@ -0,0 +1,121 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/StaticDiscoveryConfig.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+const char node_section[] =
+  "[rmw_node/talker]\n"
+  "namespace=/demo\n"
+  "participant=0123456789aB\n"
+  "config=talker_config\n";
+
+const char topic_section[] =
+  "[topic/chatter]\n"
+  "name=rt/chatter\n";
+
+class StaticDiscoveryConfigTest : public ::testing::Test
+{
+protected:
+  void TearDown() override { std::remove(file_.c_str()); }
+
+  // Parse a configuration file with these contents.
+  void parse(const std::string & contents)
+  {
+    std::ofstream(file_) << contents;
+    config_.parse(file_);
+  }
+
+  const std::string file_ = "test_static_discovery_config.ini";
+  StaticDiscoveryConfig config_;
+};
+
+std::string endpoint(const std::string & type, const std::string & participant, const std::string & entity)
+{
+  return "[endpoint/" + type + entity + "]\n"
+         "type=" + type + "\n"
+         "topic=chatter\n"
+         "participant=" + participant + "\n"
+         "entity=" + entity + "\n";
+}
+
+}  // namespace
+
+TEST_F(StaticDiscoveryConfigTest, nodes) {
+  parse(std::string(node_section) + topic_section);
+  StaticDiscoveryConfig::ParticipantId id;
+  std::string transport_config;
+  config_.get_participant("talker", "/demo", id, transport_config);
+  const StaticDiscoveryConfig::ParticipantId expected = {{0x01, 0x23, 0x45, 0x67, 0x89, 0xab}};
+  EXPECT_EQ(expected, id);
+  EXPECT_EQ("talker_config", transport_config);
+  EXPECT_THROW(config_.get_participant("talker", "/", id, transport_config), std::runtime_error);
+
+  std::string name;
+  std::string name_space;
+  ASSERT_TRUE(config_.find_node(expected, name, name_space));
+  EXPECT_EQ("talker", name);
+  EXPECT_EQ("/demo", name_space);
+  EXPECT_FALSE(config_.find_node(StaticDiscoveryConfig::ParticipantId(), name, name_space));
+}
+
+TEST_F(StaticDiscoveryConfigTest, endpoints) {
+  parse(std::string(node_section) + topic_section + endpoint("writer", "0123456789ab", "000001") +
+    endpoint("writer", "0123456789ab", "000002") + endpoint("reader", "0123456789ab", "0000FF"));
+  const StaticDiscoveryConfig::ParticipantId id = {{0x01, 0x23, 0x45, 0x67, 0x89, 0xab}};
+  const StaticDiscoveryConfig::EntityKey reader = {{0x00, 0x00, 0xff}};
+  EXPECT_EQ(reader, config_.acquire_entity(id, "rt/chatter", EntityType::Subscriber));
+  EXPECT_THROW(config_.acquire_entity(id, "rt/chatter", EntityType::Subscriber), std::runtime_error);
+  config_.release_entity(id, reader);
+  EXPECT_EQ(reader, config_.acquire_entity(id, "rt/chatter", EntityType::Subscriber));
+
+  const StaticDiscoveryConfig::EntityKey first = config_.acquire_entity(id, "rt/chatter", EntityType::Publisher);
+  const StaticDiscoveryConfig::EntityKey second = config_.acquire_entity(id, "rt/chatter", EntityType::Publisher);
+  EXPECT_NE(first, second);
+  EXPECT_THROW(config_.acquire_entity(id, "rt/chatter", EntityType::Publisher), std::runtime_error);
+  EXPECT_THROW(config_.acquire_entity(id, "chatter", EntityType::Publisher), std::runtime_error);
+}
+
+TEST_F(StaticDiscoveryConfigTest, invalid_keys) {
+  // 6 byte participant ids and 3 byte entity keys, in hex
+  EXPECT_THROW(parse(std::string(node_section) + topic_section + endpoint("writer", "0123456789", "000001")),
+    std::runtime_error);
+  EXPECT_THROW(parse(std::string(node_section) + topic_section + endpoint("writer", "0123456789abcd", "000001")),
+    std::runtime_error);
+  EXPECT_THROW(parse(std::string(node_section) + topic_section + endpoint("writer", "0123456789ag", "000001")),
+    std::runtime_error);
+  EXPECT_THROW(parse(std::string(node_section) + topic_section + endpoint("writer", "0123456789ab", "0001")),
+    std::runtime_error);
+  EXPECT_THROW(parse(std::string(node_section) + topic_section + endpoint("writer", "0123456789ab", "00000x")),
+    std::runtime_error);
+  EXPECT_THROW(parse("[rmw_node/talker]\nparticipant=\nconfig=talker_config\n"), std::runtime_error);
+}
+
+TEST_F(StaticDiscoveryConfigTest, invalid_sections) {
+  EXPECT_THROW(parse(topic_section), std::runtime_error);
+  EXPECT_THROW(parse("[rmw_node/talker]\nparticipant=0123456789ab\n"), std::runtime_error);
+  EXPECT_THROW(parse(std::string(node_section) + endpoint("writer", "0123456789ab", "000001")),
+    std::runtime_error);
+  EXPECT_THROW(parse(std::string(node_section) + topic_section + endpoint("client", "0123456789ab", "000001")),
+    std::runtime_error);
+  EXPECT_THROW(config_.parse("no_such_file.ini"), std::runtime_error);
+}
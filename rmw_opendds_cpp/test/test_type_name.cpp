@@ -0,0 +1,40 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rmw_opendds_cpp/type_name.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+TEST(TypeName, ros_names) {
+  EXPECT_EQ("sensor_msgs::msg::dds_::Image_", dds_type_name("sensor_msgs/msg/Image"));
+  EXPECT_EQ("example_interfaces::srv::dds_::AddTwoInts_Request_",
+    dds_type_name("example_interfaces/srv/AddTwoInts_Request"));
+}
+
+TEST(TypeName, message_namespace_is_implied) {
+  EXPECT_EQ("std_msgs::msg::dds_::String_", dds_type_name("std_msgs/String"));
+}
+
+TEST(TypeName, dds_names_are_kept) {
+  EXPECT_EQ("std_msgs::msg::dds_::String_", dds_type_name("std_msgs::msg::dds_::String_"));
+}
+
+TEST(TypeName, invalid_names) {
+  EXPECT_THROW(dds_type_name(""), std::runtime_error);
+  EXPECT_THROW(dds_type_name("String"), std::runtime_error);
+  EXPECT_THROW(dds_type_name("/String"), std::runtime_error);
+  EXPECT_THROW(dds_type_name("std_msgs/msg/"), std::runtime_error);
+}